@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "GenericPlatform/GenericPlatformStricmp.h"
+#include "GenericPlatform/GenericPlatformStringSimd.h"
+#include "Math/UnrealMathUtility.h"
 #include "Misc/Char.h"
 
 static constexpr uint8 LowerAscii[128] = {
@@ -88,8 +90,70 @@ int32 StrnicmpImpl(const CharType1* String1, const CharType2* String2, SIZE_T Co
 	return 0;
 }
 
-int32 FGenericPlatformStricmp::Stricmp(const ANSICHAR* Str1, const ANSICHAR* Str2) { return StricmpImpl(Str1, Str2); }
-int32 FGenericPlatformStricmp::Stricmp(const WIDECHAR* Str1, const WIDECHAR* Str2) { return StricmpImpl(Str1, Str2); }
+// Same type comparisons skip equal blocks with FGenericPlatformStringSimd and only compare characters around the
+// first difference, the terminator or a page boundary
+template<typename CharType>
+int32 StricmpSimdImpl(const CharType* String1, const CharType* String2)
+{
+	constexpr int32 BlockSize = FGenericPlatformStringSimd::GetBlockSize<CharType>();
+	while (true)
+	{
+		const SIZE_T NumEqual = FGenericPlatformStringSimd::CountEqualIgnoreCase(String1, String2, MAX_uint32);
+		String1 += NumEqual;
+		String2 += NumEqual;
+
+		if (int32 Result = StrnicmpImpl(String1, String2, BlockSize))
+		{
+			return Result;
+		}
+
+		// StrnicmpImpl returns zero both for equal blocks and when reaching the terminators
+		for (int32 Index = 0; Index < BlockSize; ++Index)
+		{
+			if (String1[Index] == 0)
+			{
+				return 0;
+			}
+		}
+		String1 += BlockSize;
+		String2 += BlockSize;
+	}
+}
+
+template<typename CharType>
+int32 StrnicmpSimdImpl(const CharType* String1, const CharType* String2, SIZE_T Count)
+{
+	constexpr int32 BlockSize = FGenericPlatformStringSimd::GetBlockSize<CharType>();
+	while (Count > 0)
+	{
+		const SIZE_T NumEqual = FGenericPlatformStringSimd::CountEqualIgnoreCase(String1, String2, Count);
+		String1 += NumEqual;
+		String2 += NumEqual;
+		Count -= NumEqual;
+
+		const SIZE_T NumScalar = FMath::Min<SIZE_T>(Count, BlockSize);
+		if (int32 Result = StrnicmpImpl(String1, String2, NumScalar))
+		{
+			return Result;
+		}
+
+		for (SIZE_T Index = 0; Index < NumScalar; ++Index)
+		{
+			if (String1[Index] == 0)
+			{
+				return 0;
+			}
+		}
+		String1 += NumScalar;
+		String2 += NumScalar;
+		Count -= NumScalar;
+	}
+
+	return 0;
+}
+
+int32 FGenericPlatformStricmp::Stricmp(const ANSICHAR* Str1, const ANSICHAR* Str2) { return StricmpSimdImpl(Str1, Str2); }
+int32 FGenericPlatformStricmp::Stricmp(const WIDECHAR* Str1, const WIDECHAR* Str2) { return StricmpSimdImpl(Str1, Str2); }
 int32 FGenericPlatformStricmp::Stricmp(const UTF8CHAR* Str1, const UTF8CHAR* Str2) { return StricmpImpl(Str1, Str2); }
 int32 FGenericPlatformStricmp::Stricmp(const UTF16CHAR* Str1, const UTF16CHAR* Str2) { return StricmpImpl(Str1, Str2); }
 int32 FGenericPlatformStricmp::Stricmp(const UTF32CHAR* Str1, const UTF32CHAR* Str2) { return StricmpImpl(Str1, Str2); }
@@ -101,8 +165,8 @@ int32 FGenericPlatformStricmp::Stricmp(const WIDECHAR* Str1, const ANSICHAR* Str
 int32 FGenericPlatformStricmp::Stricmp(const UTF8CHAR* Str1, const ANSICHAR* Str2) { return StricmpImpl(Str1, Str2); }
 int32 FGenericPlatformStricmp::Stricmp(const UTF16CHAR* Str1, const ANSICHAR* Str2) { return StricmpImpl(Str1, Str2); }
 int32 FGenericPlatformStricmp::Stricmp(const UTF32CHAR* Str1, const ANSICHAR* Str2) { return StricmpImpl(Str1, Str2); }
-int32 FGenericPlatformStricmp::Strnicmp(const ANSICHAR* Str1, const ANSICHAR* Str2, SIZE_T Count) { return StrnicmpImpl(Str1, Str2, Count); }
-int32 FGenericPlatformStricmp::Strnicmp(const WIDECHAR* Str1, const WIDECHAR* Str2, SIZE_T Count) { return StrnicmpImpl(Str1, Str2, Count); }
+int32 FGenericPlatformStricmp::Strnicmp(const ANSICHAR* Str1, const ANSICHAR* Str2, SIZE_T Count) { return StrnicmpSimdImpl(Str1, Str2, Count); }
+int32 FGenericPlatformStricmp::Strnicmp(const WIDECHAR* Str1, const WIDECHAR* Str2, SIZE_T Count) { return StrnicmpSimdImpl(Str1, Str2, Count); }
 int32 FGenericPlatformStricmp::Strnicmp(const ANSICHAR* Str1, const WIDECHAR* Str2, SIZE_T Count) { return StrnicmpImpl(Str1, Str2, Count); }
 int32 FGenericPlatformStricmp::Strnicmp(const WIDECHAR* Str1, const ANSICHAR* Str2, SIZE_T Count) { return StrnicmpImpl(Str1, Str2, Count); }
 
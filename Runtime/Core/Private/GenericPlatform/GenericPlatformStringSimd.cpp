@@ -0,0 +1,246 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GenericPlatform/GenericPlatformStringSimd.h"
+#include "Math/UnrealMathUtility.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#define UE_PLATFORM_STRING_SSE2 1
+#else
+#define UE_PLATFORM_STRING_SSE2 0
+#endif
+
+namespace PlatformStringSimd
+{
+	static constexpr UPTRINT PageSize = 4096;
+
+	/** The 16 bit paths compare whole WIDECHARs, platforms with 32 bit wchar_t use the character loops */
+	static constexpr bool bWideIs16Bit = sizeof(WIDECHAR) == 2;
+
+	/** Whether an unaligned 16 byte load from Ptr stays within its page */
+	FORCEINLINE bool CanLoadBlock(const void* Ptr)
+	{
+		return (UPTRINT(Ptr) & (PageSize - 1)) <= PageSize - 16;
+	}
+
+	template <typename CharType>
+	int32 StrlenScalar(const CharType* String)
+	{
+		const CharType* End = String;
+		while (*End)
+		{
+			++End;
+		}
+		return int32(End - String);
+	}
+
+	template <typename CharType>
+	const CharType* StrchrScalar(const CharType* String, CharType C)
+	{
+		while (*String != C && *String != 0)
+		{
+			String++;
+		}
+		return (*String == C) ? String : nullptr;
+	}
+
+#if UE_PLATFORM_STRING_SSE2
+	/** Lowers the ASCII letters of 16 chars, bytes from 0x80 are negative and never in range */
+	FORCEINLINE __m128i LowerAscii8(__m128i Chars)
+	{
+		const __m128i IsUpper = _mm_and_si128(_mm_cmpgt_epi8(Chars, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(Chars, _mm_set1_epi8('Z' + 1)));
+		return _mm_or_si128(Chars, _mm_and_si128(IsUpper, _mm_set1_epi8(0x20)));
+	}
+
+	/** Lowers the ASCII letters of 8 16 bit chars */
+	FORCEINLINE __m128i LowerAscii16(__m128i Chars)
+	{
+		const __m128i IsUpper = _mm_and_si128(_mm_cmpgt_epi16(Chars, _mm_set1_epi16('A' - 1)), _mm_cmplt_epi16(Chars, _mm_set1_epi16('Z' + 1)));
+		return _mm_or_si128(Chars, _mm_and_si128(IsUpper, _mm_set1_epi16(0x20)));
+	}
+#endif
+}
+
+int32 FGenericPlatformStringSimd::Strlen(const WIDECHAR* String)
+{
+	using namespace PlatformStringSimd;
+#if UE_PLATFORM_STRING_SSE2
+	if (bWideIs16Bit && (UPTRINT(String) & 1) == 0)
+	{
+		// Aligned loads never cross a page, mask off the characters before the string in the first block
+		const uint32 Offset = uint32(UPTRINT(String) & 15);
+		const uint8* Block = reinterpret_cast<const uint8*>(UPTRINT(String) & ~UPTRINT(15));
+		const __m128i Zero = _mm_setzero_si128();
+		uint32 Mask = uint32(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_load_si128(reinterpret_cast<const __m128i*>(Block)), Zero))) & (0xFFFFu << Offset);
+		while (Mask == 0)
+		{
+			Block += 16;
+			Mask = uint32(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_load_si128(reinterpret_cast<const __m128i*>(Block)), Zero)));
+		}
+		return int32((Block + FMath::CountTrailingZeros(Mask) - reinterpret_cast<const uint8*>(String)) / sizeof(WIDECHAR));
+	}
+#endif
+	return StrlenScalar(String);
+}
+
+const WIDECHAR* FGenericPlatformStringSimd::Strchr(const WIDECHAR* String, WIDECHAR C)
+{
+	using namespace PlatformStringSimd;
+#if UE_PLATFORM_STRING_SSE2
+	if (bWideIs16Bit && (UPTRINT(String) & 1) == 0)
+	{
+		const uint32 Offset = uint32(UPTRINT(String) & 15);
+		const uint8* Block = reinterpret_cast<const uint8*>(UPTRINT(String) & ~UPTRINT(15));
+		const __m128i Zero = _mm_setzero_si128();
+		const __m128i Wanted = _mm_set1_epi16(short(C));
+		__m128i Chars = _mm_load_si128(reinterpret_cast<const __m128i*>(Block));
+		uint32 Mask = uint32(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(Chars, Zero), _mm_cmpeq_epi16(Chars, Wanted)))) & (0xFFFFu << Offset);
+		while (Mask == 0)
+		{
+			Block += 16;
+			Chars = _mm_load_si128(reinterpret_cast<const __m128i*>(Block));
+			Mask = uint32(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(Chars, Zero), _mm_cmpeq_epi16(Chars, Wanted))));
+		}
+		const WIDECHAR* Found = reinterpret_cast<const WIDECHAR*>(Block + FMath::CountTrailingZeros(Mask));
+		return *Found == C ? Found : nullptr;
+	}
+#endif
+	return StrchrScalar(String, C);
+}
+
+SIZE_T FGenericPlatformStringSimd::CountEqualIgnoreCase(const ANSICHAR* String1, const ANSICHAR* String2, SIZE_T MaxCount)
+{
+	SIZE_T Count = 0;
+#if UE_PLATFORM_STRING_SSE2
+	using namespace PlatformStringSimd;
+	const __m128i Zero = _mm_setzero_si128();
+	while (MaxCount - Count >= 16 && CanLoadBlock(String1 + Count) && CanLoadBlock(String2 + Count))
+	{
+		const __m128i Chars1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(String1 + Count));
+		const __m128i Chars2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(String2 + Count));
+		const uint32 Equal = uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(LowerAscii8(Chars1), LowerAscii8(Chars2))));
+		const uint32 Terminators = uint32(_mm_movemask_epi8(_mm_cmpeq_epi8(Chars1, Zero)));
+		if ((Equal & ~Terminators) != 0xFFFF)
+		{
+			break;
+		}
+		Count += 16;
+	}
+#endif
+	return Count;
+}
+
+SIZE_T FGenericPlatformStringSimd::CountEqualIgnoreCase(const WIDECHAR* String1, const WIDECHAR* String2, SIZE_T MaxCount)
+{
+	SIZE_T Count = 0;
+#if UE_PLATFORM_STRING_SSE2
+	using namespace PlatformStringSimd;
+	if (bWideIs16Bit)
+	{
+		const __m128i Zero = _mm_setzero_si128();
+		while (MaxCount - Count >= 8 && CanLoadBlock(String1 + Count) && CanLoadBlock(String2 + Count))
+		{
+			const __m128i Chars1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(String1 + Count));
+			const __m128i Chars2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(String2 + Count));
+			const uint32 Equal = uint32(_mm_movemask_epi8(_mm_cmpeq_epi16(LowerAscii16(Chars1), LowerAscii16(Chars2))));
+			const uint32 Terminators = uint32(_mm_movemask_epi8(_mm_cmpeq_epi16(Chars1, Zero)));
+			if ((Equal & ~Terminators) != 0xFFFF)
+			{
+				break;
+			}
+			Count += 8;
+		}
+	}
+#endif
+	return Count;
+}
+
+int32 FGenericPlatformStringSimd::CountAscii(const ANSICHAR* String, int32 Count)
+{
+	int32 Index = 0;
+#if UE_PLATFORM_STRING_SSE2
+	for (; Index + 16 <= Count; Index += 16)
+	{
+		// Non-ASCII bytes have the sign bit set
+		if (const uint32 Mask = uint32(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(String + Index)))))
+		{
+			return Index + int32(FMath::CountTrailingZeros(Mask));
+		}
+	}
+#endif
+	while (Index < Count && uint8(String[Index]) < 0x80)
+	{
+		++Index;
+	}
+	return Index;
+}
+
+int32 FGenericPlatformStringSimd::CountAscii(const WIDECHAR* String, int32 Count)
+{
+	int32 Index = 0;
+#if UE_PLATFORM_STRING_SSE2
+	using namespace PlatformStringSimd;
+	if (bWideIs16Bit)
+	{
+		const __m128i NonAsciiBits = _mm_set1_epi16(short(0xFF80));
+		const __m128i Zero = _mm_setzero_si128();
+		for (; Index + 8 <= Count; Index += 8)
+		{
+			const __m128i Chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(String + Index));
+			const uint32 AsciiMask = uint32(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(Chars, NonAsciiBits), Zero)));
+			if (AsciiMask != 0xFFFF)
+			{
+				return Index + int32(FMath::CountTrailingZeros(~AsciiMask) / 2);
+			}
+		}
+	}
+#endif
+	while (Index < Count && uint32(String[Index]) < 0x80)
+	{
+		++Index;
+	}
+	return Index;
+}
+
+void FGenericPlatformStringSimd::WidenAscii(WIDECHAR* Dest, const ANSICHAR* Source, int32 Count)
+{
+	int32 Index = 0;
+#if UE_PLATFORM_STRING_SSE2
+	using namespace PlatformStringSimd;
+	if (bWideIs16Bit)
+	{
+		const __m128i Zero = _mm_setzero_si128();
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const __m128i Chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Index));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Index), _mm_unpacklo_epi8(Chars, Zero));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Index + 8), _mm_unpackhi_epi8(Chars, Zero));
+		}
+	}
+#endif
+	for (; Index < Count; ++Index)
+	{
+		Dest[Index] = WIDECHAR(uint8(Source[Index]));
+	}
+}
+
+void FGenericPlatformStringSimd::NarrowAscii(ANSICHAR* Dest, const WIDECHAR* Source, int32 Count)
+{
+	int32 Index = 0;
+#if UE_PLATFORM_STRING_SSE2
+	using namespace PlatformStringSimd;
+	if (bWideIs16Bit)
+	{
+		for (; Index + 16 <= Count; Index += 16)
+		{
+			const __m128i Low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Index));
+			const __m128i High = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Index + 8));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Index), _mm_packus_epi16(Low, High));
+		}
+	}
+#endif
+	for (; Index < Count; ++Index)
+	{
+		Dest[Index] = ANSICHAR(Source[Index]);
+	}
+}
@@ -83,6 +83,73 @@ TStringBuilderBase<C>& TStringBuilderBase<C>::AppendfImpl(BuilderType& Self, con
 	}
 }
 
+static const char DecimalDigitPairs[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+static inline int32 CountDecimalDigits(uint64 Value)
+{
+	int32 Count = 1;
+	for (; Value >= 10000; Value /= 10000)
+	{
+		Count += 4;
+	}
+	return Count + (Value >= 10) + (Value >= 100) + (Value >= 1000);
+}
+
+template <typename C>
+static inline void WriteDecimalDigits(C* End, uint64 Value)
+{
+	// Two digits per division, writing backwards from the last digit
+	while (Value >= 100)
+	{
+		const uint32 Pair = uint32(Value % 100) * 2;
+		Value /= 100;
+		*--End = C(DecimalDigitPairs[Pair + 1]);
+		*--End = C(DecimalDigitPairs[Pair]);
+	}
+	if (Value >= 10)
+	{
+		const uint32 Pair = uint32(Value) * 2;
+		*--End = C(DecimalDigitPairs[Pair + 1]);
+		*--End = C(DecimalDigitPairs[Pair]);
+	}
+	else
+	{
+		*--End = C('0' + Value);
+	}
+}
+
+template <typename C>
+TStringBuilderBase<C>& TStringBuilderBase<C>::AppendDecimal(uint64 Value)
+{
+	const int32 NumDigits = CountDecimalDigits(Value);
+	EnsureCapacity(NumDigits);
+	CurPos += NumDigits;
+	WriteDecimalDigits(CurPos, Value);
+	return *this;
+}
+
+template <typename C>
+TStringBuilderBase<C>& TStringBuilderBase<C>::AppendDecimal(int64 Value)
+{
+	if (Value < 0)
+	{
+		Append(C('-'));
+		// Negate as unsigned to handle the minimum value
+		return AppendDecimal(0 - uint64(Value));
+	}
+	return AppendDecimal(uint64(Value));
+}
+
 // Instantiate templates once
 
 template class TStringBuilderBase<ANSICHAR>;
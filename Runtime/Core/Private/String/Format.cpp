@@ -0,0 +1,502 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "String/Format.h"
+
+#include "Math/UnrealMathUtility.h"
+#include "Misc/AssertionMacros.h"
+#include "Misc/StringBuilder.h"
+
+namespace UE
+{
+namespace String
+{
+namespace Private
+{
+	/** A parsed [[Fill]Align][Sign][#][0][Width][.Precision][Type] spec */
+	struct FFormatSpec
+	{
+		uint32 Fill = ' ';
+		/** One of < > ^, or 0 for the default alignment of the argument type */
+		char Align = 0;
+		/** One of + - or space */
+		char Sign = '-';
+		/** The type character, or 0 for the default formatting of the argument type */
+		char Type = 0;
+		bool bAlternate = false;
+		bool bZeroPad = false;
+		int32 Width = 0;
+		/** Number of decimals or maximum number of characters, or -1 if not specified */
+		int32 Precision = -1;
+	};
+
+	static const double PowersOf10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+	static const uint64 MaxFixedPrecision = UE_ARRAY_COUNT(PowersOf10) - 1;
+
+	/** Values scaled past 2^53 can't hold every digit exactly and are left to the CRT */
+	static const double MaxScaledFixedValue = 9007199254740992.0;
+
+	template <typename CharType>
+	static FORCEINLINE bool IsDigit(CharType C)
+	{
+		return C >= CharType('0') && C <= CharType('9');
+	}
+
+	static FORCEINLINE bool IsAlign(uint32 C)
+	{
+		return C == '<' || C == '>' || C == '^';
+	}
+
+	template <typename CharType>
+	static int32 ParseNumber(const CharType*& It)
+	{
+		int32 Value = 0;
+		while (IsDigit(*It))
+		{
+			Value = Value * 10 + int32(*It++ - CharType('0'));
+			checkf(Value <= 0xffff, TEXT("Number too large in format string"));
+		}
+		return Value;
+	}
+
+	template <typename CharType>
+	static void ParseSpec(const CharType*& It, FFormatSpec& Spec)
+	{
+		// A closing brace ends an empty spec, so "{:}<" is a placeholder followed by the text "<" rather than a fill
+		if (It[0] != CharType('\0') && It[0] != CharType('}') && IsAlign(uint32(It[1])))
+		{
+			checkf(It[0] != CharType('{'), TEXT("Braces can't be used as fill in format string"));
+			Spec.Fill = uint32(It[0]);
+			Spec.Align = char(It[1]);
+			It += 2;
+		}
+		else if (IsAlign(uint32(*It)))
+		{
+			Spec.Align = char(*It++);
+		}
+
+		if (*It == CharType('+') || *It == CharType('-') || *It == CharType(' '))
+		{
+			Spec.Sign = char(*It++);
+		}
+		if (*It == CharType('#'))
+		{
+			Spec.bAlternate = true;
+			++It;
+		}
+		if (*It == CharType('0'))
+		{
+			Spec.bZeroPad = true;
+			++It;
+		}
+
+		Spec.Width = ParseNumber(It);
+
+		if (*It == CharType('.'))
+		{
+			++It;
+			checkf(IsDigit(*It), TEXT("Missing precision in format string"));
+			Spec.Precision = ParseNumber(It);
+		}
+
+		if (*It != CharType('}') && *It != CharType('\0'))
+		{
+			const CharType Type = *It++;
+			checkf(Type < 0x80, TEXT("Invalid type in format string"));
+			Spec.Type = char(Type);
+		}
+	}
+
+	/**
+	 * Pads the characters appended since Start up to the width of the spec.
+	 * Numbers pass the position after their sign and prefix as ZeroPadPos, which is where zero padding goes.
+	 */
+	template <typename CharType>
+	static void ApplyWidth(TStringBuilderBase<CharType>& Builder, int32 Start, const FFormatSpec& Spec, char DefaultAlign, int32 ZeroPadPos = -1)
+	{
+		const int32 End = Builder.Len();
+		const int32 Padding = Spec.Width - (End - Start);
+		if (Padding <= 0)
+		{
+			return;
+		}
+
+		CharType Fill = CharType(Spec.Fill);
+		int32 InsertPos = Start;
+		int32 PaddingBefore = Padding;
+		if (Spec.bZeroPad && ZeroPadPos >= 0 && !Spec.Align)
+		{
+			Fill = CharType('0');
+			InsertPos = ZeroPadPos;
+		}
+		else
+		{
+			const char Align = Spec.Align ? Spec.Align : DefaultAlign;
+			PaddingBefore = Align == '<' ? 0 : Align == '>' ? Padding : Padding / 2;
+		}
+
+		Builder.AddUninitialized(Padding);
+		CharType* Data = Builder.GetData();
+		FMemory::Memmove(Data + InsertPos + PaddingBefore, Data + InsertPos, (End - InsertPos) * sizeof(CharType));
+		for (CharType* It = Data + InsertPos, *ItEnd = It + PaddingBefore; It != ItEnd; ++It)
+		{
+			*It = Fill;
+		}
+		for (CharType* It = Data + End + PaddingBefore, *ItEnd = Data + End + Padding; It != ItEnd; ++It)
+		{
+			*It = Fill;
+		}
+	}
+
+	template <typename CharType>
+	static void AppendSign(TStringBuilderBase<CharType>& Builder, bool bNegative, const FFormatSpec& Spec)
+	{
+		if (bNegative)
+		{
+			Builder.Append(CharType('-'));
+		}
+		else if (Spec.Sign != '-')
+		{
+			Builder.Append(CharType(Spec.Sign));
+		}
+	}
+
+	/** Appends the value in base 2^Shift */
+	template <typename CharType>
+	static void AppendPowerOfTwoBase(TStringBuilderBase<CharType>& Builder, uint64 Value, uint32 Shift, bool bUpperCase)
+	{
+		int32 NumDigits = 1;
+		for (uint64 Rest = Value >> Shift; Rest; Rest >>= Shift)
+		{
+			++NumDigits;
+		}
+
+		const char* DigitChars = bUpperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+		const uint64 Mask = (uint64(1) << Shift) - 1;
+		CharType* Digits = Builder.GetData() + Builder.AddUninitialized(NumDigits);
+		for (int32 Index = NumDigits - 1; Index >= 0; --Index, Value >>= Shift)
+		{
+			Digits[Index] = CharType(DigitChars[Value & Mask]);
+		}
+	}
+
+	template <typename CharType>
+	static void FormatString(TStringBuilderBase<CharType>& Builder, const void* Data, int32 Len, bool bAnsi, const FFormatSpec& Spec)
+	{
+		checkf(Spec.Type == 0 || Spec.Type == 's', TEXT("Invalid type '%c' for a string in format string"), Spec.Type);
+		const int32 Start = Builder.Len();
+		if (Spec.Precision >= 0 && Spec.Precision < Len)
+		{
+			Len = Spec.Precision;
+		}
+		if (bAnsi)
+		{
+			Builder.AppendAnsi(static_cast<const ANSICHAR*>(Data), Len);
+		}
+		else
+		{
+			Builder.Append(static_cast<const CharType*>(Data), Len);
+		}
+		ApplyWidth(Builder, Start, Spec, '<');
+	}
+
+	template <typename CharType>
+	static void FormatInteger(TStringBuilderBase<CharType>& Builder, uint64 Magnitude, bool bNegative, const FFormatSpec& Spec)
+	{
+		const int32 Start = Builder.Len();
+		if (Spec.Type == 'c')
+		{
+			Builder.Append(CharType(Magnitude));
+			ApplyWidth(Builder, Start, Spec, '<');
+			return;
+		}
+
+		uint32 Shift = 0;
+		switch (Spec.Type)
+		{
+		case 0:
+		case 'd':
+			break;
+		case 'x':
+		case 'X':
+			Shift = 4;
+			break;
+		case 'b':
+			Shift = 1;
+			break;
+		default:
+			checkf(false, TEXT("Invalid type '%c' for an integer in format string"), Spec.Type);
+			break;
+		}
+
+		AppendSign(Builder, bNegative, Spec);
+		if (Shift && Spec.bAlternate)
+		{
+			Builder.Append(CharType('0'));
+			Builder.Append(CharType(Spec.Type));
+		}
+
+		const int32 DigitsPos = Builder.Len();
+		if (Shift)
+		{
+			AppendPowerOfTwoBase(Builder, Magnitude, Shift, Spec.Type == 'X');
+		}
+		else
+		{
+			Builder.AppendDecimal(Magnitude);
+		}
+		ApplyWidth(Builder, Start, Spec, '>', DigitsPos);
+	}
+
+	/**
+	 * Appends a non-negative value with a fixed number of decimals by scaling it to an integer, which avoids the CRT
+	 * for the magnitudes and precisions that are typical for logging.
+	 * Values that can't be scaled exactly return false without appending anything.
+	 */
+	template <typename CharType>
+	static bool TryAppendFixed(TStringBuilderBase<CharType>& Builder, double Value, int32 Precision, bool bTrimZeros)
+	{
+		if (uint64(Precision) > MaxFixedPrecision)
+		{
+			return false;
+		}
+
+		const double Scaled = Value * PowersOf10[Precision];
+		if (!(Scaled < MaxScaledFixedValue))
+		{
+			return false;
+		}
+
+		// Scaled is below 2^53, so the integer part and the fraction are exact
+		uint64 Units = uint64(Scaled);
+		const double Fraction = Scaled - double(Units);
+		if (Fraction == 0.5)
+		{
+			// The CRT rounds exact ties to even, but the product may only have become a tie by being rounded itself,
+			// so ties are left to the CRT to get the same digits
+			return false;
+		}
+		Units += Fraction > 0.5 ? 1 : 0;
+
+		const uint64 Scale = uint64(PowersOf10[Precision]);
+		uint64 Decimals = Units % Scale;
+		Builder.AppendDecimal(Units / Scale);
+
+		int32 NumDecimals = Precision;
+		if (bTrimZeros)
+		{
+			// Keep one decimal to tell floats from integers
+			for (; NumDecimals > 1 && Decimals % 10 == 0; --NumDecimals)
+			{
+				Decimals /= 10;
+			}
+		}
+
+		if (NumDecimals > 0)
+		{
+			CharType* Dest = Builder.GetData() + Builder.AddUninitialized(NumDecimals + 1);
+			Dest[0] = CharType('.');
+			for (int32 Index = NumDecimals; Index > 0; --Index, Decimals /= 10)
+			{
+				Dest[Index] = CharType('0' + Decimals % 10);
+			}
+		}
+		return true;
+	}
+
+	template <typename CharType>
+	static void AppendPrintf(TStringBuilderBase<CharType>& Builder, double Value, char Type, int32 Precision)
+	{
+		const CharType Fmt[] = { CharType('%'), CharType('.'), CharType('*'), CharType(Type), CharType('\0') };
+		Builder.Appendf(Fmt, Precision, Value);
+	}
+
+	template <typename CharType>
+	static void FormatFloat(TStringBuilderBase<CharType>& Builder, double Value, const FFormatSpec& Spec)
+	{
+		const int32 Start = Builder.Len();
+
+		uint64 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		AppendSign(Builder, (Bits >> 63) != 0, Spec);
+
+		if (!FMath::IsFinite(Value))
+		{
+			Builder.AppendAnsi(FMath::IsNaN(Value) ? "nan" : "inf");
+			ApplyWidth(Builder, Start, Spec, '>');
+			return;
+		}
+
+		const int32 DigitsPos = Builder.Len();
+		const double Abs = FMath::Abs(Value);
+		switch (Spec.Type)
+		{
+		case 0:
+			if (Spec.Precision >= 0)
+			{
+				if (!TryAppendFixed(Builder, Abs, Spec.Precision, false))
+				{
+					AppendPrintf(Builder, Abs, 'f', Spec.Precision);
+				}
+			}
+			else if ((Abs != 0.0 && Abs < 1e-4) || !TryAppendFixed(Builder, Abs, 6, true))
+			{
+				AppendPrintf(Builder, Abs, 'g', 15);
+			}
+			break;
+		case 'f':
+			if (!TryAppendFixed(Builder, Abs, Spec.Precision >= 0 ? Spec.Precision : 6, false))
+			{
+				AppendPrintf(Builder, Abs, 'f', Spec.Precision >= 0 ? Spec.Precision : 6);
+			}
+			break;
+		case 'e':
+		case 'g':
+			AppendPrintf(Builder, Abs, Spec.Type, Spec.Precision >= 0 ? Spec.Precision : 6);
+			break;
+		default:
+			checkf(false, TEXT("Invalid type '%c' for a float in format string"), Spec.Type);
+			break;
+		}
+		ApplyWidth(Builder, Start, Spec, '>', DigitsPos);
+	}
+
+	template <typename CharType>
+	static void FormatArg(TStringBuilderBase<CharType>& Builder, const TFormatArg<CharType>& Arg, const FFormatSpec& Spec)
+	{
+		switch (Arg.Type)
+		{
+		case EFormatArgType::Signed:
+			FormatInteger(Builder, Arg.Signed < 0 ? 0 - uint64(Arg.Signed) : uint64(Arg.Signed), Arg.Signed < 0, Spec);
+			break;
+		case EFormatArgType::Unsigned:
+			FormatInteger(Builder, Arg.Unsigned, false, Spec);
+			break;
+		case EFormatArgType::Float:
+			FormatFloat(Builder, Arg.Float, Spec);
+			break;
+		case EFormatArgType::Bool:
+			if (Spec.Type == 0 || Spec.Type == 's')
+			{
+				FormatString(Builder, Arg.Bool ? "true" : "false", Arg.Bool ? 4 : 5, true, Spec);
+			}
+			else
+			{
+				FormatInteger(Builder, Arg.Bool ? 1 : 0, false, Spec);
+			}
+			break;
+		case EFormatArgType::Char:
+			if (Spec.Type == 0 || Spec.Type == 'c')
+			{
+				const CharType Char = CharType(Arg.Char);
+				FormatString(Builder, &Char, 1, false, Spec);
+			}
+			else
+			{
+				FormatInteger(Builder, Arg.Char, false, Spec);
+			}
+			break;
+		case EFormatArgType::String:
+		case EFormatArgType::AnsiString:
+			FormatString(Builder, Arg.String.Data, Arg.String.Len, Arg.Type == EFormatArgType::AnsiString, Spec);
+			break;
+		case EFormatArgType::Pointer:
+		{
+			checkf(Spec.Type == 0 || Spec.Type == 'p', TEXT("Invalid type '%c' for a pointer in format string"), Spec.Type);
+			const int32 Start = Builder.Len();
+			Builder.Append(CharType('0'));
+			Builder.Append(CharType('x'));
+			const int32 DigitsPos = Builder.Len();
+			AppendPowerOfTwoBase(Builder, UPTRINT(Arg.Pointer), 4, false);
+			ApplyWidth(Builder, Start, Spec, '>', DigitsPos);
+			break;
+		}
+		case EFormatArgType::Custom:
+		{
+			checkf(Spec.Type == 0 && Spec.Precision < 0, TEXT("Only width and alignment can be specified for this type in format string"));
+			const int32 Start = Builder.Len();
+			Arg.Custom.Append(Builder, Arg.Custom.Value);
+			ApplyWidth(Builder, Start, Spec, '<');
+			break;
+		}
+		default:
+			checkNoEntry();
+			break;
+		}
+	}
+
+	template <typename CharType>
+	static TStringBuilderBase<CharType>& FormatArgsImpl(TStringBuilderBase<CharType>& Builder, const CharType* Format, const TFormatArg<CharType>* Args, int32 NumArgs)
+	{
+		int32 NextArgIndex = 0;
+		bool bExplicitIndices = false;
+		for (const CharType* It = Format; *It;)
+		{
+			const CharType* Literal = It;
+			while (*It && *It != CharType('{') && *It != CharType('}'))
+			{
+				++It;
+			}
+			Builder.Append(Literal, int32(It - Literal));
+
+			if (!*It)
+			{
+				break;
+			}
+
+			if (*It == CharType('}'))
+			{
+				checkf(It[1] == CharType('}'), TEXT("Unmatched } in format string, use }} for a literal brace"));
+				Builder.Append(CharType('}'));
+				It += 2;
+				continue;
+			}
+
+			if (It[1] == CharType('{'))
+			{
+				Builder.Append(CharType('{'));
+				It += 2;
+				continue;
+			}
+
+			++It;
+			int32 ArgIndex;
+			if (IsDigit(*It))
+			{
+				checkf(bExplicitIndices || NextArgIndex == 0, TEXT("Format string mixes {} and {Index} fields"));
+				bExplicitIndices = true;
+				ArgIndex = ParseNumber(It);
+			}
+			else
+			{
+				checkf(!bExplicitIndices, TEXT("Format string mixes {} and {Index} fields"));
+				ArgIndex = NextArgIndex++;
+			}
+
+			FFormatSpec Spec;
+			if (*It == CharType(':'))
+			{
+				++It;
+				ParseSpec(It, Spec);
+			}
+
+			checkf(*It == CharType('}'), TEXT("Unterminated field in format string"));
+			++It;
+
+			checkf(ArgIndex < NumArgs, TEXT("Format string refers to argument %d, but only %d were passed"), ArgIndex, NumArgs);
+			FormatArg(Builder, Args[ArgIndex], Spec);
+		}
+		return Builder;
+	}
+
+	FAnsiStringBuilderBase& FormatArgs(FAnsiStringBuilderBase& Builder, const ANSICHAR* Format, const TFormatArg<ANSICHAR>* Args, int32 NumArgs)
+	{
+		return FormatArgsImpl(Builder, Format, Args, NumArgs);
+	}
+
+	FWideStringBuilderBase& FormatArgs(FWideStringBuilderBase& Builder, const WIDECHAR* Format, const TFormatArg<WIDECHAR>* Args, int32 NumArgs)
+	{
+		return FormatArgsImpl(Builder, Format, Args, NumArgs);
+	}
+}
+}
+}
@@ -5,65 +5,60 @@
 #include "Containers/StringView.h"
 #include "Containers/UnrealString.h"
 #include "Misc/StringBuilder.h"
+#include "String/ParseNumber.h"
+
+// The numeric conversions parse the view in place instead of copying it to a null-terminated buffer, using the
+// bounded versions of the conversions behind the const TCHAR* overloads so that both clamp and convert the same way.
 
 void LexFromString(int8& OutValue, const FStringView& InString)
 {
-	TStringBuilder<64> Builder;
-	LexFromString(OutValue, (Builder << InString).ToString());
+	OutValue = (int8)UE::String::Private::Atoi(InString);
 }
 
 void LexFromString(int16& OutValue, const FStringView& InString)
 {
-	TStringBuilder<64> Builder;
-	LexFromString(OutValue, (Builder << InString).ToString());
+	OutValue = (int16)UE::String::Private::Atoi(InString);
 }
 
 void LexFromString(int32& OutValue, const FStringView& InString)
 {
-	TStringBuilder<64> Builder;
-	LexFromString(OutValue, (Builder << InString).ToString());
+	OutValue = UE::String::Private::Atoi(InString);
 }
 
 void LexFromString(int64& OutValue, const FStringView& InString)
 {
-	TStringBuilder<64> Builder;
-	LexFromString(OutValue, (Builder << InString).ToString());
+	OutValue = UE::String::Private::Strtoi64(InString, 10);
 }
 
 void LexFromString(uint8& OutValue, const FStringView& InString)
 {
-	TStringBuilder<64> Builder;
-	LexFromString(OutValue, (Builder << InString).ToString());
+	OutValue = (uint8)UE::String::Private::Atoi(InString);
 }
 
 void LexFromString(uint16& OutValue, const FStringView& InString)
 {
-	TStringBuilder<64> Builder;
-	LexFromString(OutValue, (Builder << InString).ToString());
+	OutValue = (uint16)UE::String::Private::Atoi(InString);
 }
 
 void LexFromString(uint32& OutValue, const FStringView& InString)
 {
-	TStringBuilder<64> Builder;
-	LexFromString(OutValue, (Builder << InString).ToString());
+	// 64 because this is unsigned and so the 32 bit conversion would clamp
+	OutValue = (uint32)UE::String::Private::Strtoi64(InString, 10);
 }
 
 void LexFromString(uint64& OutValue, const FStringView& InString)
 {
-	TStringBuilder<64> Builder;
-	LexFromString(OutValue, (Builder << InString).ToString());
+	OutValue = UE::String::Private::Strtoui64(InString, 0);
 }
 
 void LexFromString(float& OutValue, const FStringView& InString)
 {
-	TStringBuilder<64> Builder;
-	LexFromString(OutValue, (Builder << InString).ToString());
+	OutValue = UE::String::Private::Atof(InString);
 }
 
 void LexFromString(double& OutValue, const FStringView& InString)
 {
-	TStringBuilder<64> Builder;
-	LexFromString(OutValue, (Builder << InString).ToString());
+	OutValue = UE::String::Private::Atod(InString);
 }
 
 void LexFromString(bool& OutValue, const FStringView& InString)
@@ -0,0 +1,656 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "String/ParseNumber.h"
+
+#include "Containers/StringView.h"
+#include "HAL/PlatformString.h"
+#include "HAL/UnrealMemory.h"
+#include "Misc/AssertionMacros.h"
+#include "Misc/StringBuilder.h"
+
+#include <stdlib.h>
+
+namespace UE
+{
+namespace String
+{
+namespace ParseNumberPrivate
+{
+	// The parsers take a range where End is nullptr for null-terminated strings. The terminator is never a valid
+	// character in a number, so parsing stops there without needing to know the length up front.
+
+	/** Powers of 10 that are exactly representable, which makes multiplying or dividing by them correctly rounded */
+	static const double ExactPowersOf10[] =
+	{
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+		1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+	};
+
+	static const float ExactFloatPowersOf10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+	static constexpr int32 MaxMantissaDigits = 19;
+	static constexpr int64 MaxExponent = 100000;
+
+	/** A decimal number as Mantissa * 10^Exponent, with the digits that didn't fit in the mantissa dropped */
+	struct FDecimal
+	{
+		uint64 Mantissa = 0;
+		int64 Exponent = 0;
+		/** The exponent as written after the digits */
+		int64 ExplicitExponent = 0;
+		int32 NumMantissaDigits = 0;
+		bool bNegative = false;
+		bool bTruncated = false;
+	};
+
+	template <typename CharType>
+	static FORCEINLINE bool IsDigit(CharType C)
+	{
+		return uint32(C) - uint32('0') < 10;
+	}
+
+	template <typename CharType>
+	static FORCEINLINE bool IsSpace(CharType C)
+	{
+		return C == CharType(' ') || (uint32(C) - uint32('\t') < 5);
+	}
+
+	/** Returns the value of a digit or letter, or a value of at least 36 for other characters */
+	template <typename CharType>
+	static FORCEINLINE uint32 GetDigitValue(CharType C)
+	{
+		const uint32 Char = uint32(C);
+		if (Char - uint32('0') < 10)
+		{
+			return Char - uint32('0');
+		}
+		const uint32 Lower = Char | 0x20;
+		return Lower - uint32('a') < 26 ? Lower - uint32('a') + 10 : 36;
+	}
+
+	/** Returns true if the range starts with the lowercase Word, ignoring ASCII case */
+	template <typename CharType>
+	static bool StartsWithWord(const CharType* It, const CharType* End, const char* Word)
+	{
+		for (; *Word; ++It, ++Word)
+		{
+			if (It == End || (uint32(*It) | 0x20) != uint32(*Word))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static FORCEINLINE double MakeDouble(uint64 Bits)
+	{
+		double Value;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	/** Parses inf, infinity or nan after the sign, returning the end or nullptr if neither was found */
+	template <typename CharType>
+	static const CharType* ParseSpecial(const CharType* It, const CharType* End, bool bNegative, double& OutValue)
+	{
+		const uint64 SignBit = bNegative ? uint64(1) << 63 : 0;
+		if (StartsWithWord(It, End, "inf"))
+		{
+			OutValue = MakeDouble(SignBit | 0x7ff0000000000000ull);
+			return It + (StartsWithWord(It, End, "infinity") ? 8 : 3);
+		}
+		if (StartsWithWord(It, End, "nan"))
+		{
+			OutValue = MakeDouble(SignBit | 0x7ff8000000000000ull);
+			return It + 3;
+		}
+		return nullptr;
+	}
+
+	/**
+	 * Reads the sign, digits and exponent of a decimal number into Out.
+	 * Returns the end of the number, or nullptr if the range doesn't start with one.
+	 */
+	template <typename CharType>
+	static const CharType* ParseDecimal(const CharType* It, const CharType* End, FDecimal& Out)
+	{
+		if (It != End && (*It == CharType('+') || *It == CharType('-')))
+		{
+			Out.bNegative = *It == CharType('-');
+			++It;
+		}
+
+		bool bHasDigits = false;
+		for (; It != End && IsDigit(*It); ++It)
+		{
+			bHasDigits = true;
+			const uint32 Digit = uint32(*It) - uint32('0');
+			if (Out.NumMantissaDigits < MaxMantissaDigits)
+			{
+				// Leading zeros aren't significant
+				if (Out.Mantissa || Digit)
+				{
+					Out.Mantissa = Out.Mantissa * 10 + Digit;
+					++Out.NumMantissaDigits;
+				}
+			}
+			else
+			{
+				++Out.Exponent;
+				Out.bTruncated |= Digit != 0;
+			}
+		}
+
+		if (It != End && *It == CharType('.'))
+		{
+			++It;
+			for (; It != End && IsDigit(*It); ++It)
+			{
+				bHasDigits = true;
+				const uint32 Digit = uint32(*It) - uint32('0');
+				if (Out.NumMantissaDigits < MaxMantissaDigits)
+				{
+					Out.Mantissa = Out.Mantissa * 10 + Digit;
+					Out.NumMantissaDigits += Out.Mantissa != 0;
+					--Out.Exponent;
+				}
+				else
+				{
+					Out.bTruncated |= Digit != 0;
+				}
+			}
+		}
+
+		if (!bHasDigits)
+		{
+			return nullptr;
+		}
+
+		// The exponent is only part of the number if it has digits
+		if (It != End && (uint32(*It) | 0x20) == uint32('e'))
+		{
+			const CharType* ExponentIt = It + 1;
+			bool bNegativeExponent = false;
+			if (ExponentIt != End && (*ExponentIt == CharType('+') || *ExponentIt == CharType('-')))
+			{
+				bNegativeExponent = *ExponentIt == CharType('-');
+				++ExponentIt;
+			}
+			if (ExponentIt != End && IsDigit(*ExponentIt))
+			{
+				int64 Exponent = 0;
+				for (; ExponentIt != End && IsDigit(*ExponentIt); ++ExponentIt)
+				{
+					if (Exponent < MaxExponent)
+					{
+						Exponent = Exponent * 10 + (uint32(*ExponentIt) - uint32('0'));
+					}
+				}
+				Out.ExplicitExponent = bNegativeExponent ? -Exponent : Exponent;
+				Out.Exponent += Out.ExplicitExponent;
+				It = ExponentIt;
+			}
+		}
+
+		return It;
+	}
+
+	/**
+	 * Converts the number exactly when the mantissa and the power of 10 are both exactly representable, which is the
+	 * case for the short numbers found in text files. The single rounding of the multiplication or division is then
+	 * the correct rounding of the decimal number.
+	 */
+	static bool TryConvertExact(const FDecimal& Decimal, double& OutValue)
+	{
+		constexpr uint64 MaxExactMantissa = uint64(1) << 53;
+		if (Decimal.bTruncated || Decimal.Mantissa > MaxExactMantissa)
+		{
+			return false;
+		}
+
+		double Value;
+		if (Decimal.Exponent >= -22 && Decimal.Exponent <= 22)
+		{
+			Value = double(Decimal.Mantissa);
+			Value = Decimal.Exponent < 0 ? Value / ExactPowersOf10[-Decimal.Exponent] : Value * ExactPowersOf10[Decimal.Exponent];
+		}
+		else if (Decimal.Exponent > 22 && Decimal.Exponent <= 22 + 15)
+		{
+			// Move part of the exponent into the mantissa if it stays exact, as for 12e30
+			uint64 Mantissa = Decimal.Mantissa;
+			for (int64 Index = 22; Index < Decimal.Exponent; ++Index)
+			{
+				Mantissa *= 10;
+				if (Mantissa > MaxExactMantissa)
+				{
+					return false;
+				}
+			}
+			Value = double(Mantissa) * ExactPowersOf10[22];
+		}
+		else
+		{
+			return false;
+		}
+
+		OutValue = Decimal.bNegative ? -Value : Value;
+		return true;
+	}
+
+	static bool TryConvertExact(const FDecimal& Decimal, float& OutValue)
+	{
+		constexpr uint64 MaxExactMantissa = uint64(1) << 24;
+		if (Decimal.bTruncated || Decimal.Mantissa > MaxExactMantissa || Decimal.Exponent < -10 || Decimal.Exponent > 10)
+		{
+			return false;
+		}
+
+		float Value = float(Decimal.Mantissa);
+		Value = Decimal.Exponent < 0 ? Value / ExactFloatPowersOf10[-Decimal.Exponent] : Value * ExactFloatPowersOf10[Decimal.Exponent];
+		OutValue = Decimal.bNegative ? -Value : Value;
+		return true;
+	}
+
+	/**
+	 * Converts the digits of [Begin, End) with the CRT, for numbers with too many digits or too large an exponent
+	 * for an exact conversion. The digits are rewritten as an integer with an exponent, so there is no decimal point
+	 * that the CRT would interpret according to the locale.
+	 */
+	template <typename CharType, typename FloatType>
+	static void ConvertWithCRT(const CharType* Begin, const CharType* End, const FDecimal& Decimal, FloatType& OutValue)
+	{
+		TAnsiStringBuilder<128> Buffer;
+		if (Decimal.bNegative)
+		{
+			Buffer << '-';
+		}
+
+		int64 Exponent = 0;
+		bool bFraction = false;
+		for (const CharType* It = Begin; It != End && (uint32(*It) | 0x20) != uint32('e'); ++It)
+		{
+			if (IsDigit(*It))
+			{
+				Buffer << ANSICHAR(*It);
+				Exponent -= bFraction;
+			}
+			else if (*It == CharType('.'))
+			{
+				bFraction = true;
+			}
+		}
+
+		Buffer << 'e' << (Exponent + Decimal.ExplicitExponent);
+		if (sizeof(FloatType) == sizeof(float))
+		{
+			OutValue = FloatType(strtof(*Buffer, nullptr));
+		}
+		else
+		{
+			OutValue = FloatType(strtod(*Buffer, nullptr));
+		}
+	}
+
+	template <typename CharType, typename FloatType>
+	static const CharType* ParseFloatingPoint(const CharType* Begin, const CharType* End, FloatType& OutValue)
+	{
+		FDecimal Decimal;
+		const CharType* NumberEnd = ParseDecimal(Begin, End, Decimal);
+		if (!NumberEnd)
+		{
+			const CharType* It = Begin;
+			if (It != End && (*It == CharType('+') || *It == CharType('-')))
+			{
+				++It;
+			}
+			double Special;
+			const CharType* SpecialEnd = ParseSpecial(It, End, Decimal.bNegative, Special);
+			if (SpecialEnd)
+			{
+				OutValue = FloatType(Special);
+			}
+			return SpecialEnd;
+		}
+
+		if (Decimal.Mantissa == 0)
+		{
+			OutValue = Decimal.bNegative ? -FloatType(0) : FloatType(0);
+		}
+		else if (!TryConvertExact(Decimal, OutValue))
+		{
+			ConvertWithCRT(Begin, NumberEnd, Decimal, OutValue);
+		}
+		return NumberEnd;
+	}
+
+	/**
+	 * Reads the sign, base prefix and digits of an integer, saturating the magnitude on overflow.
+	 * Returns the end of the digits, or nullptr if the range doesn't start with an integer.
+	 */
+	template <typename CharType>
+	static const CharType* ParseMagnitude(const CharType* It, const CharType* End, int32 Base, uint64& OutMagnitude, bool& bOutNegative, bool& bOutOverflow)
+	{
+		checkf(Base == 0 || (Base >= 2 && Base <= 36), TEXT("Invalid base %d for parsing an integer"), Base);
+
+		bOutNegative = false;
+		bOutOverflow = false;
+		if (It != End && (*It == CharType('+') || *It == CharType('-')))
+		{
+			bOutNegative = *It == CharType('-');
+			++It;
+		}
+
+		// A 0x prefix without a hex digit after it is parsed as the integer 0
+		if ((Base == 0 || Base == 16) && It != End && *It == CharType('0') && It + 1 != End && (uint32(It[1]) | 0x20) == uint32('x')
+			&& It + 2 != End && GetDigitValue(It[2]) < 16)
+		{
+			It += 2;
+			Base = 16;
+		}
+		else if (Base == 0)
+		{
+			Base = It != End && *It == CharType('0') ? 8 : 10;
+		}
+
+		const CharType* DigitsBegin = It;
+		const uint64 MaxBeforeMultiply = MAX_uint64 / uint64(Base);
+		uint64 Magnitude = 0;
+		for (; It != End; ++It)
+		{
+			const uint32 Digit = GetDigitValue(*It);
+			if (Digit >= uint32(Base))
+			{
+				break;
+			}
+			if (Magnitude > MaxBeforeMultiply || Magnitude * Base > MAX_uint64 - Digit)
+			{
+				bOutOverflow = true;
+				Magnitude = MAX_uint64;
+			}
+			else
+			{
+				Magnitude = Magnitude * Base + Digit;
+			}
+		}
+
+		OutMagnitude = Magnitude;
+		return It != DigitsBegin ? It : nullptr;
+	}
+
+	template <typename CharType>
+	static const CharType* SkipSpace(const CharType* It, const CharType* End)
+	{
+		while (It != End && IsSpace(*It))
+		{
+			++It;
+		}
+		return It;
+	}
+
+	template <typename CharType>
+	static FORCEINLINE int32 GetParsedLen(const CharType* Begin, const CharType* End)
+	{
+		return End ? int32(End - Begin) : 0;
+	}
+
+	template <typename CharType, typename FloatType>
+	static int32 ParseFloatView(const TStringView<CharType>& View, FloatType& OutValue)
+	{
+		const CharType* Begin = View.GetData();
+		return GetParsedLen(Begin, ParseFloatingPoint(Begin, Begin + View.Len(), OutValue));
+	}
+
+	template <typename CharType>
+	static int32 ParseSignedView(const TStringView<CharType>& View, int64& OutValue, int32 Base)
+	{
+		const CharType* Begin = View.GetData();
+		uint64 Magnitude;
+		bool bNegative, bOverflow;
+		const CharType* NumberEnd = ParseMagnitude(Begin, Begin + View.Len(), Base, Magnitude, bNegative, bOverflow);
+		if (!NumberEnd || bOverflow || Magnitude > (bNegative ? uint64(MAX_int64) + 1 : uint64(MAX_int64)))
+		{
+			return 0;
+		}
+		OutValue = bNegative ? int64(0 - Magnitude) : int64(Magnitude);
+		return int32(NumberEnd - Begin);
+	}
+
+	template <typename CharType>
+	static int32 ParseUnsignedView(const TStringView<CharType>& View, uint64& OutValue, int32 Base)
+	{
+		const CharType* Begin = View.GetData();
+		uint64 Magnitude;
+		bool bNegative, bOverflow;
+		const CharType* NumberEnd = ParseMagnitude(Begin, Begin + View.Len(), Base, Magnitude, bNegative, bOverflow);
+		if (!NumberEnd || bOverflow || bNegative)
+		{
+			return 0;
+		}
+		OutValue = Magnitude;
+		return int32(NumberEnd - Begin);
+	}
+
+	// The CRT replacements below take the same ranges as the parsers, so that the null-terminated conversions of
+	// TCString and the bounded ones used for string views give the same results for the same text.
+
+	template <typename CharType, typename FloatType>
+	static FloatType Atof(const CharType* String, const CharType* End)
+	{
+		const CharType* Begin = SkipSpace(String, End);
+
+		// Hexadecimal floats are rare enough to leave to the platform, which needs a null-terminated copy of a view
+		const CharType* Digits = Begin + (Begin != End && (*Begin == CharType('+') || *Begin == CharType('-')));
+		if (Digits != End && Digits[0] == CharType('0') && Digits + 1 != End && (uint32(Digits[1]) | 0x20) == uint32('x'))
+		{
+			if (!End)
+			{
+				return FloatType(FPlatformString::Atod(String));
+			}
+			TStringBuilderWithBuffer<CharType, 64> Buffer;
+			Buffer.Append(Begin, int32(End - Begin));
+			return FloatType(FPlatformString::Atod(*Buffer));
+		}
+
+		FloatType Value = 0;
+		ParseFloatingPoint(Begin, End, Value);
+		return Value;
+	}
+
+	template <typename CharType>
+	static int64 Strtoi64(const CharType* Start, const CharType* Limit, CharType** End, int32 Base, int64 MinValue, int64 MaxValue)
+	{
+		const CharType* Begin = SkipSpace(Start, Limit);
+		uint64 Magnitude;
+		bool bNegative, bOverflow;
+		const CharType* NumberEnd = ParseMagnitude(Begin, Limit, Base, Magnitude, bNegative, bOverflow);
+		if (End)
+		{
+			*End = const_cast<CharType*>(NumberEnd ? NumberEnd : Start);
+		}
+		if (!NumberEnd)
+		{
+			return 0;
+		}
+		if (bNegative)
+		{
+			return Magnitude >= uint64(0) - uint64(MinValue) ? MinValue : int64(0 - Magnitude);
+		}
+		return Magnitude >= uint64(MaxValue) ? MaxValue : int64(Magnitude);
+	}
+
+	template <typename CharType>
+	static uint64 Strtoui64(const CharType* Start, const CharType* Limit, CharType** End, int32 Base)
+	{
+		const CharType* Begin = SkipSpace(Start, Limit);
+		uint64 Magnitude;
+		bool bNegative, bOverflow;
+		const CharType* NumberEnd = ParseMagnitude(Begin, Limit, Base, Magnitude, bNegative, bOverflow);
+		if (End)
+		{
+			*End = const_cast<CharType*>(NumberEnd ? NumberEnd : Start);
+		}
+		if (!NumberEnd)
+		{
+			return 0;
+		}
+		// Like strtoull, a minus sign negates the value unless it overflowed
+		return bNegative && !bOverflow ? 0 - Magnitude : Magnitude;
+	}
+}
+
+	int32 ParseDouble(const FAnsiStringView& View, double& OutValue)
+	{
+		return ParseNumberPrivate::ParseFloatView(View, OutValue);
+	}
+
+	int32 ParseDouble(const FWideStringView& View, double& OutValue)
+	{
+		return ParseNumberPrivate::ParseFloatView(View, OutValue);
+	}
+
+	int32 ParseFloat(const FAnsiStringView& View, float& OutValue)
+	{
+		return ParseNumberPrivate::ParseFloatView(View, OutValue);
+	}
+
+	int32 ParseFloat(const FWideStringView& View, float& OutValue)
+	{
+		return ParseNumberPrivate::ParseFloatView(View, OutValue);
+	}
+
+	int32 ParseInteger(const FAnsiStringView& View, int64& OutValue, int32 Base)
+	{
+		return ParseNumberPrivate::ParseSignedView(View, OutValue, Base);
+	}
+
+	int32 ParseInteger(const FWideStringView& View, int64& OutValue, int32 Base)
+	{
+		return ParseNumberPrivate::ParseSignedView(View, OutValue, Base);
+	}
+
+	int32 ParseInteger(const FAnsiStringView& View, uint64& OutValue, int32 Base)
+	{
+		return ParseNumberPrivate::ParseUnsignedView(View, OutValue, Base);
+	}
+
+	int32 ParseInteger(const FWideStringView& View, uint64& OutValue, int32 Base)
+	{
+		return ParseNumberPrivate::ParseUnsignedView(View, OutValue, Base);
+	}
+
+namespace Private
+{
+	double Atod(const ANSICHAR* String)
+	{
+		return ParseNumberPrivate::Atof<ANSICHAR, double>(String, nullptr);
+	}
+
+	double Atod(const WIDECHAR* String)
+	{
+		return ParseNumberPrivate::Atof<WIDECHAR, double>(String, nullptr);
+	}
+
+	double Atod(const FAnsiStringView& View)
+	{
+		return ParseNumberPrivate::Atof<ANSICHAR, double>(View.GetData(), View.GetData() + View.Len());
+	}
+
+	double Atod(const FWideStringView& View)
+	{
+		return ParseNumberPrivate::Atof<WIDECHAR, double>(View.GetData(), View.GetData() + View.Len());
+	}
+
+	float Atof(const ANSICHAR* String)
+	{
+		return ParseNumberPrivate::Atof<ANSICHAR, float>(String, nullptr);
+	}
+
+	float Atof(const WIDECHAR* String)
+	{
+		return ParseNumberPrivate::Atof<WIDECHAR, float>(String, nullptr);
+	}
+
+	float Atof(const FAnsiStringView& View)
+	{
+		return ParseNumberPrivate::Atof<ANSICHAR, float>(View.GetData(), View.GetData() + View.Len());
+	}
+
+	float Atof(const FWideStringView& View)
+	{
+		return ParseNumberPrivate::Atof<WIDECHAR, float>(View.GetData(), View.GetData() + View.Len());
+	}
+
+	int32 Atoi(const ANSICHAR* String)
+	{
+		return int32(ParseNumberPrivate::Strtoi64(String, (const ANSICHAR*)nullptr, (ANSICHAR**)nullptr, 10, MIN_int32, MAX_int32));
+	}
+
+	int32 Atoi(const WIDECHAR* String)
+	{
+		return int32(ParseNumberPrivate::Strtoi64(String, (const WIDECHAR*)nullptr, (WIDECHAR**)nullptr, 10, MIN_int32, MAX_int32));
+	}
+
+	int32 Atoi(const FAnsiStringView& View)
+	{
+		return int32(ParseNumberPrivate::Strtoi64(View.GetData(), View.GetData() + View.Len(), (ANSICHAR**)nullptr, 10, MIN_int32, MAX_int32));
+	}
+
+	int32 Atoi(const FWideStringView& View)
+	{
+		return int32(ParseNumberPrivate::Strtoi64(View.GetData(), View.GetData() + View.Len(), (WIDECHAR**)nullptr, 10, MIN_int32, MAX_int32));
+	}
+
+	// Strtoi truncates a 64 bit value like the platform versions did, so 32 bit hex values such as the parts of an
+	// FGuid keep their bits instead of clamping at MAX_int32
+	int32 Strtoi(const ANSICHAR* Start, ANSICHAR** End, int32 Base)
+	{
+		return int32(ParseNumberPrivate::Strtoi64(Start, (const ANSICHAR*)nullptr, End, Base, MIN_int64, MAX_int64));
+	}
+
+	int32 Strtoi(const WIDECHAR* Start, WIDECHAR** End, int32 Base)
+	{
+		return int32(ParseNumberPrivate::Strtoi64(Start, (const WIDECHAR*)nullptr, End, Base, MIN_int64, MAX_int64));
+	}
+
+	int64 Strtoi64(const ANSICHAR* Start, ANSICHAR** End, int32 Base)
+	{
+		return ParseNumberPrivate::Strtoi64(Start, (const ANSICHAR*)nullptr, End, Base, MIN_int64, MAX_int64);
+	}
+
+	int64 Strtoi64(const WIDECHAR* Start, WIDECHAR** End, int32 Base)
+	{
+		return ParseNumberPrivate::Strtoi64(Start, (const WIDECHAR*)nullptr, End, Base, MIN_int64, MAX_int64);
+	}
+
+	int64 Strtoi64(const FAnsiStringView& View, int32 Base)
+	{
+		return ParseNumberPrivate::Strtoi64(View.GetData(), View.GetData() + View.Len(), (ANSICHAR**)nullptr, Base, MIN_int64, MAX_int64);
+	}
+
+	int64 Strtoi64(const FWideStringView& View, int32 Base)
+	{
+		return ParseNumberPrivate::Strtoi64(View.GetData(), View.GetData() + View.Len(), (WIDECHAR**)nullptr, Base, MIN_int64, MAX_int64);
+	}
+
+	uint64 Strtoui64(const ANSICHAR* Start, ANSICHAR** End, int32 Base)
+	{
+		return ParseNumberPrivate::Strtoui64(Start, (const ANSICHAR*)nullptr, End, Base);
+	}
+
+	uint64 Strtoui64(const WIDECHAR* Start, WIDECHAR** End, int32 Base)
+	{
+		return ParseNumberPrivate::Strtoui64(Start, (const WIDECHAR*)nullptr, End, Base);
+	}
+
+	uint64 Strtoui64(const FAnsiStringView& View, int32 Base)
+	{
+		return ParseNumberPrivate::Strtoui64(View.GetData(), View.GetData() + View.Len(), (ANSICHAR**)nullptr, Base);
+	}
+
+	uint64 Strtoui64(const FWideStringView& View, int32 Base)
+	{
+		return ParseNumberPrivate::Strtoui64(View.GetData(), View.GetData() + View.Len(), (WIDECHAR**)nullptr, Base);
+	}
+}
+}
+}
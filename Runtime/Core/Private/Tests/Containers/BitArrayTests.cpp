@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Containers/BitArray.h"
+#include "Containers/BitArrayRankSelect.h"
+#include "Math/RandomStream.h"
 #include "Misc/AutomationTest.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -65,6 +67,45 @@ namespace BitArrayTest
 		return true;
 	}
 
+	/** Random bits made of runs of zeros, ones and noise, so that both the word skipping and the per-bit paths are exercised */
+	TArray<bool> MakeRandomBits(FRandomStream& Random, int32 Num)
+	{
+		TArray<bool> Bits;
+		Bits.Reserve(Num);
+		while (Bits.Num() < Num)
+		{
+			const int32 RunLength = FMath::Min(Random.RandRange(1, 200), Num - Bits.Num());
+			const int32 RunKind = Random.RandRange(0, 2);
+			for (int32 Index = 0; Index < RunLength; ++Index)
+			{
+				Bits.Add(RunKind == 2 ? Random.RandRange(0, 1) == 1 : RunKind == 1);
+			}
+		}
+		return Bits;
+	}
+
+	TBitArray<> MakeBitArray(const TArray<bool>& Bits)
+	{
+		TBitArray<> Out;
+		for (bool bBit : Bits)
+		{
+			Out.Add(bBit);
+		}
+		return Out;
+	}
+
+	/** Combines the bits of A and B one at a time, reading the bits past the end of either operand as bMissingBitValue */
+	TArray<bool> CombineBits(const TArray<bool>& A, const TArray<bool>& B, int32 Num, bool bMissingBitValue, bool (*Op)(bool, bool))
+	{
+		TArray<bool> Out;
+		Out.Reserve(Num);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Out.Add(Op(Index < A.Num() ? A[Index] : bMissingBitValue, Index < B.Num() ? B[Index] : bMissingBitValue));
+		}
+		return Out;
+	}
+
 } // namespace BitArrayTest
 } // namespace UE
 
@@ -1477,11 +1518,7 @@ public:
 
 	// TODO: GetAllocatedSize
 	// TODO: CountBytes
-	// TODO: Find
-	// TODO: FindLast
 	// TODO: Contains
-	// TODO: FindAndSetFirstZeroBit
-	// TODO: FindAndSetLastZeroBit
 	// TODO: IsValidIndex
 	// TODO: AccessCorrespondingBit
 	// TODO: Iteration
@@ -2027,6 +2064,224 @@ bool FBitArrayBitwiseXORTest::RunTest(const FString& Parameters)
 }
 
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBitArrayRankSelectTest, "System.Core.Containers.BitArray.RankSelect", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FBitArrayRankSelectTest::RunTest(const FString& Parameters)
+{
+	// Large arrays with long runs of empty and full words, so the bulk scans and the rank blocks are exercised
+	for (int32 Num : { 0, 1, 31, 32, 33, 127, 128, 129, 511, 512, 513, 5000 })
+	{
+		TBitArray<> Array(false, Num);
+		TArray<int32> SetIndices;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			const bool bValue = (Index / 300) % 3 == 1 ? Index % 7 != 0 : Index % 97 == 5;
+			Array[Index] = bValue;
+			if (bValue)
+			{
+				SetIndices.Add(Index);
+			}
+		}
+
+		const int32 ExpectedFirst = SetIndices.Num() ? SetIndices[0] : INDEX_NONE;
+		const int32 ExpectedLast = SetIndices.Num() ? SetIndices.Last() : INDEX_NONE;
+		TestEqual(FString::Printf(TEXT("Find in %d bits"), Num), Array.Find(true), ExpectedFirst);
+		TestEqual(FString::Printf(TEXT("FindLast in %d bits"), Num), Array.FindLast(true), ExpectedLast);
+		TestEqual(FString::Printf(TEXT("CountSetBits in %d bits"), Num), Array.CountSetBits(), SetIndices.Num());
+		if (Num > 2)
+		{
+			int32 Expected = 0;
+			for (int32 Index : SetIndices)
+			{
+				Expected += Index >= 1 && Index < Num - 1;
+			}
+			TestEqual(FString::Printf(TEXT("CountSetBits in a range of %d bits"), Num), Array.CountSetBits(1, Num - 1), Expected);
+		}
+
+		TArray<int32> Visited;
+		Array.ForEachSetBit([&Visited](int32 Index) { Visited.Add(Index); });
+		TestTrue(FString::Printf(TEXT("ForEachSetBit in %d bits"), Num), Visited == SetIndices);
+
+		Visited.Reset();
+		for (TConstSetBitIterator<> It(Array); It; ++It)
+		{
+			Visited.Add(It.GetIndex());
+		}
+		TestTrue(FString::Printf(TEXT("TConstSetBitIterator in %d bits"), Num), Visited == SetIndices);
+
+		const FBitArrayRankSelect RankSelect(Array);
+		TestEqual(FString::Printf(TEXT("RankSelect CountSetBits in %d bits"), Num), RankSelect.CountSetBits(), SetIndices.Num());
+		bool bRanksMatch = RankSelect.Rank(Num) == SetIndices.Num();
+		for (int32 Rank = 0; Rank < SetIndices.Num(); ++Rank)
+		{
+			bRanksMatch &= RankSelect.Select(Rank) == SetIndices[Rank];
+			bRanksMatch &= RankSelect.Rank(SetIndices[Rank]) == Rank;
+			bRanksMatch &= RankSelect.Rank(SetIndices[Rank] + 1) == Rank + 1;
+		}
+		TestTrue(FString::Printf(TEXT("Rank and Select in %d bits"), Num), bRanksMatch);
+		TestEqual(FString::Printf(TEXT("Select past the last set bit in %d bits"), Num), RankSelect.Select(SetIndices.Num()), INDEX_NONE);
+	}
+
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBitArrayReferenceTest, "System.Core.Containers.BitArray.Reference", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FBitArrayReferenceTest::RunTest(const FString& Parameters)
+{
+	using namespace UE::BitArrayTest;
+
+	// Compares the operations that work on whole words against the same operations on an array of bools. The seed is
+	// fixed so that a failing iteration can be reproduced. Comparing bit arrays with operator== also compares the slack
+	// bits of the last word, which must stay zero.
+	struct FBinaryOp
+	{
+		const TCHAR* Name;
+		TBitArray<> (*Bitwise)(const TBitArray<>&, const TBitArray<>&, EBitwiseOperatorFlags);
+		TBitArray<>& (TBitArray<>::*CombineWith)(const TBitArray<>&, EBitwiseOperatorFlags);
+		bool (*Op)(bool, bool);
+	};
+	const FBinaryOp BinaryOps[] =
+	{
+		{ TEXT("AND"), &TBitArray<>::BitwiseAND, &TBitArray<>::CombineWithBitwiseAND, [](bool A, bool B) { return A && B; } },
+		{ TEXT("OR"),  &TBitArray<>::BitwiseOR,  &TBitArray<>::CombineWithBitwiseOR,  [](bool A, bool B) { return A || B; } },
+		{ TEXT("XOR"), &TBitArray<>::BitwiseXOR, &TBitArray<>::CombineWithBitwiseXOR, [](bool A, bool B) { return A != B; } },
+	};
+
+	FRandomStream Random(0xB17A);
+	for (int32 Iteration = 0; Iteration < 200; ++Iteration)
+	{
+		auto Check = [this, Iteration](const FString& What, bool bMatches)
+		{
+			if (!bMatches)
+			{
+				AddError(FString::Printf(TEXT("%s differs from the reference in iteration %d"), *What, Iteration));
+			}
+		};
+
+		const TArray<bool> Bits = MakeRandomBits(Random, Random.RandRange(0, 700));
+		const TBitArray<> Array = MakeBitArray(Bits);
+		const int32 Num = Bits.Num();
+
+		for (bool bValue : { false, true })
+		{
+			Check(TEXT("Find"), Array.Find(bValue) == Bits.Find(bValue));
+			Check(TEXT("FindLast"), Array.FindLast(bValue) == Bits.FindLast(bValue));
+		}
+
+		// The start index passed to FindAndSetFirstZeroBit may be anywhere up to the first zero bit
+		{
+			TBitArray<> Result = Array;
+			TArray<bool> Expected = Bits;
+			int32 StartIndex = 0;
+			for (int32 Step = 0; Step < 4; ++Step)
+			{
+				const int32 ExpectedIndex = Expected.Find(false);
+				if (ExpectedIndex != INDEX_NONE)
+				{
+					StartIndex = Random.RandRange(StartIndex, ExpectedIndex);
+					Expected[ExpectedIndex] = true;
+				}
+				Check(TEXT("FindAndSetFirstZeroBit"), Result.FindAndSetFirstZeroBit(StartIndex) == ExpectedIndex);
+			}
+			Check(TEXT("FindAndSetFirstZeroBit bits"), Result == MakeBitArray(Expected));
+		}
+		{
+			TBitArray<> Result = Array;
+			TArray<bool> Expected = Bits;
+			for (int32 Step = 0; Step < 4; ++Step)
+			{
+				const int32 ExpectedIndex = Expected.FindLast(false);
+				if (ExpectedIndex != INDEX_NONE)
+				{
+					Expected[ExpectedIndex] = true;
+				}
+				Check(TEXT("FindAndSetLastZeroBit"), Result.FindAndSetLastZeroBit() == ExpectedIndex);
+			}
+			Check(TEXT("FindAndSetLastZeroBit bits"), Result == MakeBitArray(Expected));
+		}
+
+		{
+			const int32 FromIndex = Random.RandRange(0, Num);
+			const int32 ToIndex = Random.RandRange(FromIndex, Num);
+			int32 Expected = 0;
+			int32 ExpectedInRange = 0;
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				Expected += Bits[Index] ? 1 : 0;
+				ExpectedInRange += Bits[Index] && Index >= FromIndex && Index < ToIndex ? 1 : 0;
+			}
+			Check(TEXT("CountSetBits"), Array.CountSetBits() == Expected);
+			Check(TEXT("CountSetBits in a range"), Array.CountSetBits(FromIndex, ToIndex) == ExpectedInRange);
+		}
+
+		{
+			const int32 StartIndex = Random.RandRange(0, Num);
+			TArray<int32> Expected;
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				if (Bits[Index])
+				{
+					Expected.Add(Index);
+				}
+			}
+
+			TArray<int32> Visited;
+			Array.ForEachSetBit([&Visited](int32 Index) { Visited.Add(Index); });
+			Check(TEXT("ForEachSetBit"), Visited == Expected);
+
+			Visited.Reset();
+			for (TConstSetBitIterator<> It(Array, StartIndex); It; ++It)
+			{
+				Visited.Add(It.GetIndex());
+			}
+			Expected.RemoveAll([StartIndex](int32 Index) { return Index < StartIndex; });
+			Check(TEXT("TConstSetBitIterator"), Visited == Expected);
+		}
+
+		{
+			TBitArray<> Result = Array;
+			Result.BitwiseNOT();
+			Check(TEXT("BitwiseNOT"), Result == MakeBitArray(CombineBits(Bits, Bits, Num, false, [](bool A, bool B) { return !A; })));
+		}
+
+		// Operands of different lengths, with the bits past the shorter one missing or filled with ones
+		const TArray<bool> OtherBits = MakeRandomBits(Random, Random.RandRange(0, 700));
+		const TBitArray<> Other = MakeBitArray(OtherBits);
+		const int32 MinNum = FMath::Min(Num, OtherBits.Num());
+		const int32 MaxNum = FMath::Max(Num, OtherBits.Num());
+		for (const FBinaryOp& BinaryOp : BinaryOps)
+		{
+			Check(FString::Printf(TEXT("Bitwise%s MinSize"), BinaryOp.Name),
+				BinaryOp.Bitwise(Array, Other, EBitwiseOperatorFlags::MinSize) == MakeBitArray(CombineBits(Bits, OtherBits, MinNum, false, BinaryOp.Op)));
+			Check(FString::Printf(TEXT("Bitwise%s MaxSize"), BinaryOp.Name),
+				BinaryOp.Bitwise(Array, Other, EBitwiseOperatorFlags::MaxSize) == MakeBitArray(CombineBits(Bits, OtherBits, MaxNum, false, BinaryOp.Op)));
+			Check(FString::Printf(TEXT("Bitwise%s MaxSize with one fill"), BinaryOp.Name),
+				BinaryOp.Bitwise(Array, Other, EBitwiseOperatorFlags::MaxSize | EBitwiseOperatorFlags::OneFillMissingBits) == MakeBitArray(CombineBits(Bits, OtherBits, MaxNum, true, BinaryOp.Op)));
+
+			for (bool bOneFill : { false, true })
+			{
+				const EBitwiseOperatorFlags FillFlag = bOneFill ? EBitwiseOperatorFlags::OneFillMissingBits : EBitwiseOperatorFlags(0);
+				const TCHAR* FillName = bOneFill ? TEXT(" with one fill") : TEXT("");
+
+				TBitArray<> Result = Array;
+				(Result.*BinaryOp.CombineWith)(Other, EBitwiseOperatorFlags::MinSize | FillFlag);
+				Check(FString::Printf(TEXT("CombineWithBitwise%s MinSize%s"), BinaryOp.Name, FillName), Result == MakeBitArray(CombineBits(Bits, OtherBits, MinNum, bOneFill, BinaryOp.Op)));
+
+				Result = Array;
+				(Result.*BinaryOp.CombineWith)(Other, EBitwiseOperatorFlags::MaxSize | FillFlag);
+				Check(FString::Printf(TEXT("CombineWithBitwise%s MaxSize%s"), BinaryOp.Name, FillName), Result == MakeBitArray(CombineBits(Bits, OtherBits, MaxNum, bOneFill, BinaryOp.Op)));
+
+				Result = Array;
+				(Result.*BinaryOp.CombineWith)(Other, EBitwiseOperatorFlags::MaintainSize | FillFlag);
+				Check(FString::Printf(TEXT("CombineWithBitwise%s MaintainSize%s"), BinaryOp.Name, FillName), Result == MakeBitArray(CombineBits(Bits, OtherBits, Num, bOneFill, BinaryOp.Op)));
+			}
+		}
+	}
+
+	return true;
+}
+
+
 class FBitArrayMemoryTest : public FAutomationTestBase
 {
 public:
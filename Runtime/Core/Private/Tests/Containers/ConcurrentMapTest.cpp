@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Containers/ConcurrentMap.h"
+#include "Async/ParallelFor.h"
+#include "Misc/AutomationTest.h"
+#include "Templates/Atomic.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FConcurrentMapTest, "System.Core.Containers.ConcurrentMap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FConcurrentMapTest::RunTest(const FString& Parameters)
+{
+	{
+		// Many threads asking for the same keys construct each value exactly once
+		constexpr int32 NumKeys = 100;
+		TConcurrentMap<int32, int32> Map;
+		TAtomic<int32> NumConstructed(0);
+		TAtomic<int32> NumWrongValues(0);
+		ParallelFor(NumKeys * 100, [&Map, &NumConstructed, &NumWrongValues](int32 Index)
+		{
+			const int32 Key = Index % NumKeys;
+			const int32 Value = Map.FindOrAdd(Key, [Key, &NumConstructed]()
+			{
+				++NumConstructed;
+				return Key * 10;
+			});
+			if (Value != Key * 10)
+			{
+				++NumWrongValues;
+			}
+		});
+		TestEqual(TEXT("FindOrAdd constructs each value once"), NumConstructed.Load(), NumKeys);
+		TestEqual(TEXT("FindOrAdd returns the constructed value"), NumWrongValues.Load(), 0);
+		TestEqual(TEXT("Num after FindOrAdd"), Map.Num(), NumKeys);
+
+		// Every pair is visited once
+		TAtomic<int32> NumVisited(0);
+		TAtomic<int64> KeySum(0);
+		Map.ParallelForEach([&NumVisited, &KeySum](int32 Key, int32 Value)
+		{
+			++NumVisited;
+			KeySum += Key;
+		});
+		TestEqual(TEXT("ParallelForEach visits every pair"), NumVisited.Load(), NumKeys);
+		TestEqual(TEXT("ParallelForEach visits every key"), KeySum.Load(), int64(NumKeys - 1) * NumKeys / 2);
+
+		int32 NumForEach = 0;
+		Map.ForEach([&NumForEach](int32 Key, int32 Value) { ++NumForEach; });
+		TestEqual(TEXT("ForEach visits every pair"), NumForEach, NumKeys);
+
+		// Removing from all shards at once only affects the removed keys
+		ParallelFor(NumKeys, [&Map](int32 Key)
+		{
+			if (Key % 2 == 0)
+			{
+				Map.Remove(Key);
+			}
+		});
+		bool bRemoveValid = true;
+		for (int32 Key = 0; Key < NumKeys; ++Key)
+		{
+			int32 Value = -1;
+			const bool bFound = Map.Find(Key, Value);
+			bRemoveValid &= (Key % 2 == 0) ? (!bFound && !Map.Contains(Key)) : (bFound && Value == Key * 10);
+		}
+		TestTrue(TEXT("Find after Remove"), bRemoveValid);
+		TestEqual(TEXT("Num after Remove"), Map.Num(), NumKeys / 2);
+		TestEqual(TEXT("Remove missing key"), Map.Remove(0), 0);
+		TestEqual(TEXT("Remove existing key"), Map.Remove(1), 1);
+		TestEqual(TEXT("FindRef of a missing key"), Map.FindRef(1), 0);
+
+		Map.Empty();
+		TestEqual(TEXT("Empty"), Map.Num(), 0);
+	}
+
+	{
+		// Append keeps the last value of duplicate keys
+		TArray<TPair<FString, int32>> Pairs;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			Pairs.Emplace(FString::Printf(TEXT("Key%d"), Index % 500), Index);
+		}
+
+		TConcurrentMap<FString, int32> Map;
+		Map.Add(TEXT("Existing"), 1);
+		Map.Append(Pairs);
+		TestEqual(TEXT("Num after Append"), Map.Num(), 501);
+
+		bool bAppendValid = Map.FindRef(TEXT("Existing")) == 1;
+		for (int32 Index = 0; Index < 500; ++Index)
+		{
+			bAppendValid &= Map.FindRef(FString::Printf(TEXT("Key%d"), Index)) == Index + 500;
+		}
+		TestTrue(TEXT("Append replaces earlier pairs"), bAppendValid);
+
+		bool bApplied = false;
+		TestTrue(TEXT("FindAndApply"), Map.FindAndApply(TEXT("Key0"), [&bApplied](const int32& Value) { bApplied = Value == 500; }));
+		TestTrue(TEXT("FindAndApply passes the value"), bApplied);
+	}
+
+	{
+		// Values convertible to the value type pick the same Add overload as TMap
+		TConcurrentMap<int32, FString> Map;
+		Map.Add(1, TEXT("One"));
+		const FString Two(TEXT("Two"));
+		Map.Add(2, Two);
+		TestEqual(TEXT("Add with a convertible value"), *Map.FindRef(1), TEXT("One"));
+		TestEqual(TEXT("Add with a const value"), *Map.FindRef(2), TEXT("Two"));
+
+		TConcurrentMap<int32, int64> WideMap;
+		WideMap.Add(1, 5);
+		TestEqual(TEXT("Add with an arithmetic conversion"), WideMap.FindRef(1), int64(5));
+
+		TestEqual(TEXT("FindOrAdd with a convertible constructed value"), *Map.FindOrAdd(3, []() { return TEXT("Three"); }), TEXT("Three"));
+		TestEqual(TEXT("FindOrAdd with an arithmetic conversion"), WideMap.FindOrAdd(2, []() { return 7; }), int64(7));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Containers/FrozenMap.h"
+#include "Containers/UnrealString.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFrozenMapTest, "System.Core.Containers.FrozenMap", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FFrozenMapTest::RunTest(const FString& Parameters)
+{
+	const TFrozenMap<int32, int32> Empty;
+	TestNull(TEXT("Find in an empty map"), Empty.Find(0));
+
+	for (int32 Num : { 1, 2, 3, 7, 8, 15, 16, 17, 100, 1000 })
+	{
+		// Even keys in reverse order, with a stale pair before every fourth key to test that the last pair wins
+		TArray<TPair<int32, int32>> Pairs;
+		for (int32 Index = Num - 1; Index >= 0; --Index)
+		{
+			if (Index % 4 == 0)
+			{
+				Pairs.Emplace(Index * 2, -1);
+			}
+			Pairs.Emplace(Index * 2, Index);
+		}
+
+		const TFrozenMap<int32, int32> Map(MoveTemp(Pairs));
+		TestEqual(TEXT("Duplicate keys are removed"), Map.Num(), Num);
+
+		bool bAllFound = true;
+		for (int32 Key = -1; Key <= Num * 2; ++Key)
+		{
+			const int32* Value = Map.Find(Key);
+			bAllFound &= (Key >= 0 && Key % 2 == 0 && Key < Num * 2) ? Value && *Value == Key / 2 : Value == nullptr;
+		}
+		TestTrue(FString::Printf(TEXT("Find every key and none other in a map of %d"), Num), bAllFound);
+	}
+
+	TArray<TPair<FString, int32>> Names;
+	Names.Emplace(TEXT("Delta"), 4);
+	Names.Emplace(TEXT("Alpha"), 1);
+	Names.Emplace(TEXT("Charlie"), 3);
+	Names.Emplace(TEXT("Bravo"), 2);
+	TFrozenMap<FString, int32> Map(MoveTemp(Names));
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Writer << Map;
+
+	TFrozenMap<FString, int32> Loaded;
+	FMemoryReader Reader(Bytes);
+	Reader << Loaded;
+	TestEqual(TEXT("Serialized Num"), Loaded.Num(), 4);
+	TestEqual(TEXT("Find after loading"), Loaded.FindRef(TEXT("Charlie")), 3);
+	TestFalse(TEXT("Contains after loading"), Loaded.Contains(TEXT("Echo")));
+
+	const TFrozenMapView<FString, int32> View(Loaded.GetKeys(), Loaded.GetValues());
+	TestEqual(TEXT("Find in a view"), View.FindChecked(TEXT("Bravo")), 2);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Containers/SegmentedArray.h"
+#include "Async/ParallelFor.h"
+#include "Containers/BitArray.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSegmentedArrayTest, "System.Core.Containers.SegmentedArray", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FSegmentedArrayTest::RunTest(const FString& Parameters)
+{
+	{
+		// Addresses stay stable across segment boundaries
+		TSegmentedArray<int32, 4> Array;
+		int32& First = Array.EmplaceGetRef(100);
+		for (int32 Index = 1; Index < 100; ++Index)
+		{
+			TestEqual(TEXT("Emplace returns the next index"), Array.Emplace(Index), Index);
+		}
+		TestTrue(TEXT("The first element didn't move"), &First == &Array[0]);
+		TestEqual(TEXT("The first element kept its value"), First, 100);
+
+		int32 Expected = 0;
+		bool bInOrder = true;
+		for (int32 Value : Array)
+		{
+			bInOrder &= Value == (Expected == 0 ? 100 : Expected);
+			++Expected;
+		}
+		TestTrue(TEXT("Iteration visits the elements in order"), bInOrder && Expected == 100);
+		TestEqual(TEXT("ToArray copies every element"), Array.ToArray().Num(), 100);
+
+		Array.Empty();
+		TestEqual(TEXT("Empty"), Array.Num(), 0);
+		TestTrue(TEXT("Iterating an empty array"), !(Array.begin() != Array.end()));
+	}
+
+	{
+		// Concurrent appends end up with every value exactly once
+		constexpr int32 Num = 100000;
+		TSegmentedArray<int32> Array;
+		ParallelFor(Num, [&Array](int32 Index)
+		{
+			Array.Emplace(Index);
+		});
+		TestEqual(TEXT("Concurrent Emplace count"), Array.Num(), Num);
+
+		TBitArray<> Seen(false, Num);
+		bool bValid = true;
+		Array.ForEach([&Seen, &bValid](int32 Value)
+		{
+			if (Value >= 0 && Value < Num && !Seen[Value])
+			{
+				Seen[Value] = true;
+			}
+			else
+			{
+				bValid = false;
+			}
+		});
+		TestTrue(TEXT("Concurrent Emplace values"), bValid && Seen.Find(false) == INDEX_NONE);
+
+		Array.ParallelForEach([](int32& Value) { Value = -Value; }, 256);
+		int64 Sum = 0;
+		const TSegmentedArray<int32>& ConstArray = Array;
+		ConstArray.ForEach([&Sum](const int32& Value) { Sum += Value; });
+		TestEqual(TEXT("ParallelForEach visits every element"), Sum, -int64(Num - 1) * Num / 2);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
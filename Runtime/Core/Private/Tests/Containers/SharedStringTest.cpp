@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Containers/InlineString.h"
+#include "Containers/SharedString.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/StringBuilder.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInlineStringTest, "System.Core.String.InlineString", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FInlineStringTest::RunTest(const FString& Parameters)
+{
+	TInlineString<8> Str;
+	TestTrue(TEXT("Default is empty"), Str.IsEmpty());
+	TestEqual(TEXT("Empty string"), *Str, TEXT(""));
+
+	Str += TEXT("Short");
+	TestTrue(TEXT("Short strings stay inline"), Str.IsInline());
+	TestEqual(TEXT("Len"), Str.Len(), 5);
+
+	Str += TEXT("AndLong");
+	TestFalse(TEXT("Long strings allocate"), Str.IsInline());
+	TestEqual(TEXT("Append"), *Str, TEXT("ShortAndLong"));
+
+	Str += Str.ToView().Left(5);
+	TestEqual(TEXT("Append a view of itself"), *Str, TEXT("ShortAndLongShort"));
+
+	TStringBuilder<64> Builder;
+	Builder << Str;
+	TestEqual(TEXT("Append to a string builder"), Builder.ToString(), *Str);
+
+	const FStringView View = Str;
+	TestTrue(TEXT("Converts to a view"), View == TEXT("shortandlongshort"));
+	TestEqual(TEXT("Hash matches FString"), GetTypeHash(Str), GetTypeHash(Str.ToString()));
+
+	Str.Empty();
+	TestTrue(TEXT("Empty returns to the inline storage"), Str.IsEmpty() && Str.IsInline());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSharedStringTest, "System.Core.String.SharedString", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FSharedStringTest::RunTest(const FString& Parameters)
+{
+	const FSharedString Empty;
+	TestTrue(TEXT("Default is empty"), Empty.IsEmpty());
+	TestEqual(TEXT("Empty string"), *Empty, TEXT(""));
+	TestTrue(TEXT("Empty from an empty view"), FSharedString(FStringView()).IsEmpty());
+
+	FSharedString Str(TEXT("/Game/Maps/Entry"));
+	const FSharedString Copy = Str;
+	TestTrue(TEXT("Copies share the characters"), Copy.IsSameData(Str));
+	TestEqual(TEXT("Copy"), *Copy, TEXT("/Game/Maps/Entry"));
+
+	const FSharedString Other(FString(TEXT("/game/maps/entry")));
+	TestFalse(TEXT("Separately built strings don't share"), Other.IsSameData(Str));
+	TestTrue(TEXT("Comparison ignores case"), Other == Str);
+	TestEqual(TEXT("Hash matches FString"), GetTypeHash(Str), GetTypeHash(FString(TEXT("/Game/Maps/Entry"))));
+
+	FSharedString Moved = MoveTemp(Str);
+	TestTrue(TEXT("Moved from is empty"), Str.IsEmpty());
+	TestTrue(TEXT("Move keeps the characters"), Moved.IsSameData(Copy));
+
+	TStringBuilder<64> Builder;
+	Builder << Moved;
+	TestEqual(TEXT("Append to a string builder"), Builder.ToString(), *Moved);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
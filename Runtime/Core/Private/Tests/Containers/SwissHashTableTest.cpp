@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Experimental/Containers/SwissHashTable.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSwissSetTest, "System.Core.Containers.SwissHashTable.Set", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FSwissSetTest::RunTest(const FString& Parameters)
+{
+	using namespace Experimental;
+
+	// Randomized adds and removes checked against TSet, enough to grow several times and leave deleted slots behind
+	{
+		TSwissSet<int32> Set;
+		TSet<int32> Expected;
+		FRandomStream Random(0x5155);
+		for (int32 Step = 0; Step < 20000; ++Step)
+		{
+			const int32 Value = Random.RandRange(0, 4096);
+			if (Random.RandRange(0, 2) == 0)
+			{
+				TestEqual(TEXT("Remove"), Set.Remove(Value), Expected.Remove(Value));
+			}
+			else
+			{
+				bool bIsAlreadyInSet = false;
+				const FSetElementId Id = Set.Add(Value, &bIsAlreadyInSet);
+				TestEqual(TEXT("Add reports existing keys"), bIsAlreadyInSet, Expected.Contains(Value));
+				TestEqual(TEXT("Add returns the element id"), Set[Id], Value);
+				Expected.Add(Value);
+			}
+		}
+
+		TestEqual(TEXT("Num"), Set.Num(), Expected.Num());
+		for (int32 Value = 0; Value <= 4096; ++Value)
+		{
+			TestEqual(TEXT("Contains"), Set.Contains(Value), Expected.Contains(Value));
+		}
+
+		int32 NumIterated = 0;
+		for (int32 Value : Set)
+		{
+			TestTrue(TEXT("Iterated element is expected"), Expected.Contains(Value));
+			++NumIterated;
+		}
+		TestEqual(TEXT("Iteration visits every element once"), NumIterated, Expected.Num());
+	}
+
+	// Removing while iterating
+	{
+		TSwissSet<int32> Set;
+		for (int32 Value = 0; Value < 1000; ++Value)
+		{
+			Set.Add(Value);
+		}
+		for (TSwissSet<int32>::TIterator It = Set.CreateIterator(); It; ++It)
+		{
+			if (*It % 3 == 0)
+			{
+				It.RemoveCurrent();
+			}
+		}
+		TestEqual(TEXT("RemoveCurrent"), Set.Num(), 666);
+		TestFalse(TEXT("Removed element"), Set.Contains(999));
+		TestTrue(TEXT("Kept element"), Set.Contains(998));
+
+		// Same size rehash drops the deleted slots
+		Set.Shrink();
+		TestEqual(TEXT("Shrink keeps elements"), Set.Num(), 666);
+		TestTrue(TEXT("Shrink keeps lookups"), Set.Contains(998));
+	}
+
+	// Non-trivial elements, copies and moves
+	{
+		TSwissSet<FString> Set;
+		Set.Reserve(100);
+		const int32 Capacity = Set.GetMaxIndex();
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			Set.Add(FString::Printf(TEXT("Element%d"), Index));
+		}
+		TestEqual(TEXT("Reserve avoids growing"), Set.GetMaxIndex(), Capacity);
+
+		TSwissSet<FString> Copy = Set;
+		TSwissSet<FString> Moved = MoveTemp(Set);
+		TestEqual(TEXT("Moved from is empty"), Set.Num(), 0);
+		TestEqual(TEXT("Copy"), Copy.Num(), 100);
+		TestEqual(TEXT("Move"), Moved.Num(), 100);
+		TestTrue(TEXT("Copy lookup"), Copy.Contains(TEXT("Element42")));
+		TestTrue(TEXT("Move lookup"), Moved.Contains(TEXT("Element42")));
+
+		Moved.Reset();
+		TestEqual(TEXT("Reset keeps the allocation"), Moved.GetMaxIndex(), Capacity);
+		TestFalse(TEXT("Reset"), Moved.Contains(TEXT("Element42")));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSwissMapTest, "System.Core.Containers.SwissHashTable.Map", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FSwissMapTest::RunTest(const FString& Parameters)
+{
+	using namespace Experimental;
+
+	TSwissMap<FString, int32> Map;
+	TMap<FString, int32> Expected;
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		const FString Key = FString::Printf(TEXT("Key%d"), Index % 300);
+		Map.FindOrAdd(Key) += Index;
+		Expected.FindOrAdd(Key) += Index;
+	}
+
+	TestEqual(TEXT("Num"), Map.Num(), Expected.Num());
+	for (const TPair<FString, int32>& Pair : Expected)
+	{
+		TestEqual(TEXT("FindRef"), Map.FindRef(Pair.Key), Pair.Value);
+	}
+
+	Map.Add(TEXT("Key0"), -1);
+	TestEqual(TEXT("Add replaces the value"), Map.FindChecked(TEXT("Key0")), -1);
+	TestEqual(TEXT("Add doesn't duplicate keys"), Map.Num(), Expected.Num());
+	TestEqual(TEXT("FindOrAdd keeps existing values"), Map.FindOrAdd(TEXT("Key0"), 5), -1);
+
+	int32 RemovedValue = 0;
+	TestTrue(TEXT("RemoveAndCopyValue"), Map.RemoveAndCopyValue(TEXT("Key0"), RemovedValue));
+	TestEqual(TEXT("RemoveAndCopyValue copies the value"), RemovedValue, -1);
+	TestEqual(TEXT("Remove"), Map.Remove(TEXT("Key1")), 1);
+	TestEqual(TEXT("Remove missing key"), Map.Remove(TEXT("Key1")), 0);
+	TestNull(TEXT("Find removed key"), Map.Find(TEXT("Key1")));
+	TestEqual(TEXT("Num after remove"), Map.Num(), Expected.Num() - 2);
+
+	{
+		// Set allocators are accepted like in TMap, the inline one keeps small tables out of the heap
+		TSwissMap<int32, int32, TInlineSetAllocator<32>> InlineMap;
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			InlineMap.Add(Index, Index * 2);
+		}
+		bool bAllFound = InlineMap.Num() == 100;
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			bAllFound &= InlineMap.FindRef(Index) == Index * 2;
+		}
+		TestTrue(TEXT("Map with an inline set allocator"), bAllFound);
+
+		TSwissMap<int32, int32, TInlineSetAllocator<32>> MovedMap = MoveTemp(InlineMap);
+		TestEqual(TEXT("Moved map with an inline set allocator"), MovedMap.FindRef(99), 198);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
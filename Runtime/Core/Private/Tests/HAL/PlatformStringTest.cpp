@@ -2,7 +2,10 @@
 
 #include "HAL/PlatformString.h"
 
+#include "GenericPlatform/GenericPlatformStringSimd.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/CString.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -49,4 +52,129 @@ bool FPlatformStringTestStrnlen::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlatformStringTestSimd, "System.Core.HAL.PlatformString.Simd", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+bool FPlatformStringTestSimd::RunTest(const FString& Parameters)
+{
+	// Cover every alignment and lengths around the block sizes
+	alignas(16) WIDECHAR Wide[80];
+	alignas(16) ANSICHAR Ansi[80];
+	alignas(16) ANSICHAR AnsiUpper[80];
+	for (int32 Start = 0; Start < 8; ++Start)
+	{
+		for (int32 Len = 0; Len < 40; ++Len)
+		{
+			for (int32 Index = 0; Index < Len; ++Index)
+			{
+				Wide[Start + Index] = WIDECHAR('a' + Index % 26);
+				Ansi[Start + Index] = ANSICHAR('a' + Index % 26);
+				AnsiUpper[Start + Index] = ANSICHAR('A' + Index % 26);
+			}
+			Wide[Start + Len] = 0;
+			Ansi[Start + Len] = 0;
+			AnsiUpper[Start + Len] = 0;
+
+			TestEqual(TEXT("Strlen"), FGenericPlatformStringSimd::Strlen(Wide + Start), Len);
+			TestTrue(TEXT("Strchr finds the terminator"), FGenericPlatformStringSimd::Strchr(Wide + Start, 0) == Wide + Start + Len);
+			TestTrue(TEXT("Strchr finds the last character"), Len == 0 || FGenericPlatformStringSimd::Strchr(Wide + Start, Wide[Start + Len - 1]) == Wide + Start + (Len - 1) % 26);
+			TestNull(TEXT("Strchr of a missing character"), FGenericPlatformStringSimd::Strchr(Wide + Start, WIDECHAR('#')));
+
+			TestEqual(TEXT("Stricmp of equal strings"), FCStringAnsi::Stricmp(Ansi + Start, AnsiUpper + Start), 0);
+			TestEqual(TEXT("Strnicmp of equal strings"), FCStringAnsi::Strnicmp(Ansi + Start, AnsiUpper + Start, Len + 1), 0);
+			if (Len > 0)
+			{
+				AnsiUpper[Start + Len - 1] = '#';
+				TestTrue(TEXT("Stricmp finds the last difference"), FCStringAnsi::Stricmp(Ansi + Start, AnsiUpper + Start) > 0);
+				TestEqual(TEXT("Strnicmp stops before the difference"), FCStringAnsi::Strnicmp(Ansi + Start, AnsiUpper + Start, Len - 1), 0);
+				TestTrue(TEXT("Strnicmp finds the last difference"), FCStringAnsi::Strnicmp(Ansi + Start, AnsiUpper + Start, Len) > 0);
+			}
+		}
+	}
+
+	TestEqual(TEXT("Stricmp of a shorter string"), FCString::Stricmp(TEXT("ABCDEFGHIJKLMNOPQRSTUVWXYZ"), TEXT("abcdefghijklmnopqrstuvwxy")), int32('z'));
+	TestEqual(TEXT("Stricmp of non-ASCII characters"), FMath::Sign(FCString::Stricmp(TEXT("abcdefghijklmnop\u00C0"), TEXT("ABCDEFGHIJKLMNOP\u00E0"))), -1);
+
+	return true;
+}
+
+/** Returns the time per call in nanoseconds of calling Func NumIterations times, Func returns a value to keep the calls from being optimized away */
+template <typename FuncType>
+static double TimePlatformStringCalls(int32 NumIterations, int64& Sink, FuncType&& Func)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		Sink += Func();
+	}
+	return (FPlatformTime::Seconds() - StartTime) * 1e9 / NumIterations;
+}
+
+/**
+ * Times the vectorized string primitives against character loops on short and long strings.
+ * Pass the number of iterations as parameter to change it from the default.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPlatformStringTestSimdPerf, "System.Core.HAL.PlatformString.SimdPerf", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FPlatformStringTestSimdPerf::RunTest(const FString& Parameters)
+{
+	const int32 NumIterations = Parameters.IsNumeric() ? FMath::Max(FCString::Atoi(*Parameters), 1) : 100000;
+	for (int32 Len : { 8, 24, 64, 256, 4096 })
+	{
+		TArray<WIDECHAR> Wide;
+		TArray<WIDECHAR> WideUpper;
+		TArray<ANSICHAR> Ansi;
+		TArray<ANSICHAR> AnsiUpper;
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			Wide.Add(WIDECHAR('a' + Index % 26));
+			WideUpper.Add(WIDECHAR('A' + Index % 26));
+			Ansi.Add(ANSICHAR('a' + Index % 26));
+			AnsiUpper.Add(ANSICHAR('A' + Index % 26));
+		}
+		Wide.Add(0);
+		WideUpper.Add(0);
+		Ansi.Add(0);
+		AnsiUpper.Add(0);
+		TArray<WIDECHAR> WideDest;
+		WideDest.SetNumUninitialized(Len);
+
+		int64 Sink = 0;
+		const double StrlenTime = TimePlatformStringCalls(NumIterations, Sink, [&Wide]()
+		{
+			return FGenericPlatformStringSimd::Strlen(Wide.GetData());
+		});
+		const double StrlenScalarTime = TimePlatformStringCalls(NumIterations, Sink, [&Wide]()
+		{
+			const WIDECHAR* Char = Wide.GetData();
+			while (*Char)
+			{
+				++Char;
+			}
+			return Char - Wide.GetData();
+		});
+		const double StrchrTime = TimePlatformStringCalls(NumIterations, Sink, [&Wide]()
+		{
+			return FGenericPlatformStringSimd::Strchr(Wide.GetData(), WIDECHAR('#')) != nullptr;
+		});
+		const double StricmpTime = TimePlatformStringCalls(NumIterations, Sink, [&Wide, &WideUpper]()
+		{
+			return FCStringWide::Stricmp(Wide.GetData(), WideUpper.GetData());
+		});
+		const double AnsiStricmpTime = TimePlatformStringCalls(NumIterations, Sink, [&Ansi, &AnsiUpper]()
+		{
+			return FCStringAnsi::Stricmp(Ansi.GetData(), AnsiUpper.GetData());
+		});
+		const double WidenTime = TimePlatformStringCalls(NumIterations, Sink, [&Ansi, &WideDest, Len]()
+		{
+			const int32 Count = FGenericPlatformStringSimd::CountAscii(Ansi.GetData(), Len);
+			FGenericPlatformStringSimd::WidenAscii(WideDest.GetData(), Ansi.GetData(), Count);
+			return Count;
+		});
+
+		TestEqual(TEXT("Strlen"), FGenericPlatformStringSimd::Strlen(Wide.GetData()), Len);
+		AddInfo(FString::Printf(TEXT("Len %5d: Strlen %8.1fns (loop %8.1fns)   Strchr %8.1fns   Stricmp %8.1fns   Stricmp(ANSI) %8.1fns   CountAscii+WidenAscii %8.1fns   (%lld)"),
+			Len, StrlenTime, StrlenScalarTime, StrchrTime, StricmpTime, AnsiStricmpTime, WidenTime, Sink));
+	}
+
+	return true;
+}
+
 #endif //WITH_DEV_AUTOMATION_TESTS
@@ -1,7 +1,10 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "CoreTypes.h"
+#include "Containers/StringConv.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/StringBuilder.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -109,4 +112,122 @@ bool FTCharToUTF8Test::RunTest(const FString& Parameters)
 	return !HasAnyErrors();
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUTF8ConversionRunsTest, "System.Core.Misc.Utf8ConversionRuns", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FUTF8ConversionRunsTest::RunTest(const FString& Parameters)
+{
+	// ASCII runs of every length around the vector width, surrounded by multi-byte characters
+	for (int32 RunLen = 0; RunLen < 40; ++RunLen)
+	{
+		FString TestString = UTF16_TO_TCHAR(u"\x00E9");
+		for (int32 Index = 0; Index < RunLen; ++Index)
+		{
+			TestString.AppendChar(TCHAR('a' + Index % 26));
+		}
+		TestString += UTF16_TO_TCHAR(u"\xD83D\xDE06");
+		TestString += TestString.Mid(1, RunLen);
+
+		const FTCHARToUTF8 Encoded(*TestString, TestString.Len());
+		TestEqual(TEXT("Encoded length"), Encoded.Length(), 2 + 4 + RunLen * 2);
+		TestTrue(TEXT("Encoded is valid UTF-8"), StringConv::IsValidUtf8(Encoded.Get(), Encoded.Length()));
+
+		const FUTF8ToTCHAR Decoded(Encoded.Get(), Encoded.Length());
+		TestTrue(TEXT("Round trip"), FString(Decoded.Length(), Decoded.Get()).Equals(TestString, ESearchCase::CaseSensitive));
+
+		TStringBuilder<16> Builder;
+		Builder << TEXT("<");
+		StringConv::AppendUtf8(Builder, Encoded.Get(), Encoded.Length());
+		TestTrue(TEXT("AppendUtf8"), FStringView(Builder).Equals(FString(TEXT("<")) + TestString, ESearchCase::CaseSensitive));
+
+		TAnsiStringBuilder<16> AnsiBuilder;
+		StringConv::AppendTCHARToUtf8(AnsiBuilder, *TestString, TestString.Len());
+		TestTrue(TEXT("AppendTCHARToUtf8"), FAnsiStringView(AnsiBuilder).Equals(FAnsiStringView(Encoded.Get(), Encoded.Length()), ESearchCase::CaseSensitive));
+	}
+
+	TestTrue(TEXT("Empty is valid UTF-8"), StringConv::IsValidUtf8("", 0));
+	TestTrue(TEXT("Largest codepoint"), StringConv::IsValidUtf8("\xF4\x8F\xBF\xBF", 4));
+	TestFalse(TEXT("Stray continuation byte"), StringConv::IsValidUtf8("abcdefghijklmnopq\x80", 18));
+	TestFalse(TEXT("Overlong encoding"), StringConv::IsValidUtf8("\xC0\xAF", 2));
+	TestFalse(TEXT("Overlong three byte encoding"), StringConv::IsValidUtf8("\xE0\x80\xAF", 3));
+	TestFalse(TEXT("Encoded surrogate"), StringConv::IsValidUtf8("\xED\xA0\x80", 3));
+	TestFalse(TEXT("Above 10FFFFh"), StringConv::IsValidUtf8("\xF4\x90\x80\x80", 4));
+	TestFalse(TEXT("Truncated sequence"), StringConv::IsValidUtf8("abc\xE2\x84", 5));
+
+	return !HasAnyErrors();
+}
+
+/** Returns the throughput in MB/s of calling Func NumIterations times on NumBytes of text, Func returns a value to keep the calls from being optimized away */
+template <typename FuncType>
+static double TimeUtf8Conversion(int32 NumIterations, int32 NumBytes, int64& Sink, FuncType&& Func)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		Sink += Func();
+	}
+	const double Time = FPlatformTime::Seconds() - StartTime;
+	return Time > 0.0 ? double(NumBytes) * NumIterations / (1024.0 * 1024.0 * Time) : 0.0;
+}
+
+/**
+ * Measures the UTF-8 transcoders, whose ASCII runs go through CopyAsciiRun, on mostly ASCII and mostly non-ASCII text.
+ * Pass the number of iterations as parameter to change it from the default.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUTF8ConversionPerfTest, "System.Core.Misc.Utf8ConversionPerf", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FUTF8ConversionPerfTest::RunTest(const FString& Parameters)
+{
+	const int32 NumIterations = Parameters.IsNumeric() ? FMath::Max(FCString::Atoi(*Parameters), 1) : 1000;
+
+	FString AsciiText;
+	FString MixedText;
+	for (int32 Index = 0; Index < 4096; ++Index)
+	{
+		AsciiText.AppendChar(TCHAR(' ' + Index % 95));
+		MixedText.AppendChar(Index % 4 == 0 ? TCHAR(0x00E9) : TCHAR('a' + Index % 26));
+	}
+
+	for (const FString* Text : { &AsciiText, &MixedText })
+	{
+		const FTCHARToUTF8 Utf8Text(**Text, Text->Len());
+		const int32 NumBytes = Utf8Text.Length();
+		TArray<ANSICHAR> Utf8Buffer;
+		TArray<TCHAR> TCHARBuffer;
+		Utf8Buffer.SetNumUninitialized(Text->Len() * 3);
+		TCHARBuffer.SetNumUninitialized(NumBytes);
+		TStringBuilder<8192> Builder;
+
+		int64 Sink = 0;
+		const double EncodeSpeed = TimeUtf8Conversion(NumIterations, NumBytes, Sink, [Text, &Utf8Buffer]()
+		{
+			return FTCHARToUTF8_Convert::Convert(Utf8Buffer.GetData(), Utf8Buffer.Num(), **Text, Text->Len());
+		});
+		const double EncodedLengthSpeed = TimeUtf8Conversion(NumIterations, NumBytes, Sink, [Text]()
+		{
+			return FTCHARToUTF8_Convert::ConvertedLength(**Text, Text->Len());
+		});
+		const double DecodeSpeed = TimeUtf8Conversion(NumIterations, NumBytes, Sink, [&Utf8Text, &TCHARBuffer]()
+		{
+			FUTF8ToTCHAR_Convert::Convert(TCHARBuffer.GetData(), TCHARBuffer.Num(), Utf8Text.Get(), Utf8Text.Length());
+			return TCHARBuffer[0];
+		});
+		const double AppendSpeed = TimeUtf8Conversion(NumIterations, NumBytes, Sink, [&Utf8Text, &Builder]()
+		{
+			Builder.Reset();
+			StringConv::AppendUtf8(Builder, Utf8Text.Get(), Utf8Text.Length());
+			return Builder.Len();
+		});
+		const double ValidateSpeed = TimeUtf8Conversion(NumIterations, NumBytes, Sink, [&Utf8Text]()
+		{
+			return StringConv::IsValidUtf8(Utf8Text.Get(), Utf8Text.Length());
+		});
+
+		TestTrue(TEXT("AppendUtf8 round trips"), FStringView(Builder).Equals(*Text, ESearchCase::CaseSensitive));
+		AddInfo(FString::Printf(TEXT("%s: encode %8.1f MB/s   encoded length %8.1f MB/s   decode %8.1f MB/s   AppendUtf8 %8.1f MB/s   validate %8.1f MB/s   (%lld)"),
+			Text == &AsciiText ? TEXT("ASCII") : TEXT("Mixed"), EncodeSpeed, EncodedLengthSpeed, DecodeSpeed, AppendSpeed, ValidateSpeed, Sink));
+	}
+
+	return !HasAnyErrors();
+}
+
 #endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "String/Format.h"
+
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/StringBuilder.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(StringFormatTest, "System.Core.String.Format", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool StringFormatTest::RunTest(const FString& Parameters)
+{
+	auto TestFormat = [this](const TCHAR* Expected, const FString& Actual)
+	{
+		TestEqual(FString::Printf(TEXT("UE::String::Format expected \"%s\""), Expected), Actual, Expected);
+	};
+
+	enum class ETestEnum : uint8 { Zero, One, Two };
+
+	// Fields and escapes
+	TestFormat(TEXT("No fields"), UE::String::Format(TEXT("No fields")));
+	TestFormat(TEXT("{Braces}"), UE::String::Format(TEXT("{{Braces}}")));
+	TestFormat(TEXT("1 2 3"), UE::String::Format(TEXT("{} {} {}"), 1, 2, 3));
+	TestFormat(TEXT("B A B"), UE::String::Format(TEXT("{1} {0} {1}"), TEXT("A"), TEXT("B")));
+	TestFormat(TEXT("1<2>"), UE::String::Format(TEXT("{:}<{:}>"), 1, 2));
+
+	// Integers
+	TestFormat(TEXT("-2147483648 4294967295"), UE::String::Format(TEXT("{} {}"), MIN_int32, MAX_uint32));
+	TestFormat(TEXT("-9223372036854775808 18446744073709551615"), UE::String::Format(TEXT("{} {}"), MIN_int64, MAX_uint64));
+	TestFormat(TEXT("0 10 99 100 1000 10000"), UE::String::Format(TEXT("{} {} {} {} {} {}"), 0, 10, 99, 100, 1000, 10000));
+	TestFormat(TEXT("ff FF 0xff 101"), UE::String::Format(TEXT("{:x} {:X} {:#x} {:b}"), 255, 255, 255, 5));
+	TestFormat(TEXT("[   42] [42   ] [ 42  ] [-0042] [+42]"), UE::String::Format(TEXT("[{:5}] [{:<5}] [{:^5}] [{:05}] [{:+}]"), 42, 42, 42, -42, 42));
+	TestFormat(TEXT("0x00ff *42**"), UE::String::Format(TEXT("{:#06x} {:*^5}"), 255, 42));
+	TestFormat(TEXT("2 -1"), UE::String::Format(TEXT("{} {}"), ETestEnum::Two, int8(-1)));
+
+	// Floats
+	TestFormat(TEXT("1.5 2.0 -0.25 0.333333"), UE::String::Format(TEXT("{} {} {} {}"), 1.5f, 2.0, -0.25, 1.0 / 3.0));
+	TestFormat(TEXT("3.14 3.142 3.141593 3"), UE::String::Format(TEXT("{:.2f} {:.3} {:f} {:.0f}"), 3.14159, 3.14159, 3.14159, 3.14159));
+	TestFormat(TEXT("  1.50 001.50"), UE::String::Format(TEXT("{:6.2f} {:06.2f}"), 1.5, 1.5));
+	TestFormat(TEXT("0.12 0.38 2 4 0.13"), UE::String::Format(TEXT("{:.2f} {:.2f} {:.0f} {:.0f} {:.2f}"), 0.125, 0.375, 2.5, 3.5, 0.1251));
+	TestFormat(*FString::Printf(TEXT("%.6e %.15g %.15g"), 12345.678, 1e-7, 1e20), UE::String::Format(TEXT("{:e} {} {}"), 12345.678, 1e-7, 1e20));
+
+	// Strings, characters and bools
+	TestFormat(TEXT("Wide Ansi String View"), UE::String::Format(TEXT("{} {} {} {}"), TEXT("Wide"), "Ansi", FString(TEXT("String")), TEXT("View"_SV)));
+	TestFormat(TEXT("[ab   ] [  abc] [ab]"), UE::String::Format(TEXT("[{:5}] [{:>5}] [{:.2}]"), TEXT("ab"), TEXT("abc"), TEXT("abc")));
+	TestFormat(TEXT("x 120 true false"), UE::String::Format(TEXT("{} {:d} {} {}"), TEXT('x'), TEXT('x'), true, false));
+
+	// Builders and other contiguous strings
+	TStringBuilder<16> Nested;
+	Nested << TEXT("Nested");
+	TestFormat(TEXT("[Nested  ]"), UE::String::Format(TEXT("[{:8}]"), Nested));
+
+	// Appending to an existing builder of either character type
+	TAnsiStringBuilder<8> AnsiBuilder;
+	AnsiBuilder << "Ansi";
+	UE::String::FormatTo(AnsiBuilder, " {}={:.2f}", "Value", 0.3125);
+	TestEqual(TEXT("UE::String::FormatTo with an ANSI builder"), FString(AnsiBuilder.ToString()), TEXT("Ansi Value=0.31"));
+
+	// Integer append operators
+	TStringBuilder<64> Builder;
+	Builder << int8(-128) << TEXT(' ') << uint16(65535) << TEXT(' ') << MIN_int64;
+	TestEqual(TEXT("Integer append operators"), FStringView(Builder), TEXT("-128 65535 -9223372036854775808"_SV));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,141 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "String/ParseNumber.h"
+
+#include "Containers/StringView.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CString.h"
+#include "String/LexFromString.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ParseNumberTest
+{
+	/** Returns true if LexFromString gives the same value for a null-terminated string and for a view of it followed by more digits */
+	template <typename T>
+	static bool LexFromStringAgrees(const TCHAR* String)
+	{
+		T FromString = T(1);
+		LexFromString(FromString, String);
+
+		const FString Padded = FString(String) + TEXT("123");
+		T FromView = T(2);
+		LexFromString(FromView, FStringView(*Padded, FCString::Strlen(String)));
+
+		return FMemory::Memcmp(&FromString, &FromView, sizeof(T)) == 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(StringParseNumberTest, "System.Core.String.ParseNumber", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool StringParseNumberTest::RunTest(const FString& Parameters)
+{
+	auto TestDouble = [this](const TCHAR* String, int32 ExpectedLen, double Expected)
+	{
+		double Value = -1.0;
+		const int32 Len = UE::String::ParseDouble(FStringView(String), Value);
+		TestEqual(FString::Printf(TEXT("ParseDouble length for \"%s\""), String), Len, ExpectedLen);
+		TestTrue(FString::Printf(TEXT("ParseDouble value for \"%s\""), String), ExpectedLen == 0 ? Value == -1.0 : Value == Expected);
+	};
+
+	TestDouble(TEXT("0"), 1, 0.0);
+	TestDouble(TEXT("1.5"), 3, 1.5);
+	TestDouble(TEXT("-0.1"), 4, -0.1);
+	TestDouble(TEXT(".5,"), 2, 0.5);
+	TestDouble(TEXT("5."), 2, 5.0);
+	TestDouble(TEXT("2.5e3m"), 5, 2500.0);
+	TestDouble(TEXT("1e"), 1, 1.0);
+	TestDouble(TEXT("12e30"), 5, 12e30);
+	TestDouble(TEXT("0.30000000000000004"), 19, 0.30000000000000004);
+	TestDouble(TEXT("1.7976931348623157e308"), 22, 1.7976931348623157e308);
+	TestDouble(TEXT("2.2250738585072014e-308"), 23, 2.2250738585072014e-308);
+	TestDouble(TEXT("123456789012345678901234567890"), 30, 123456789012345678901234567890.0);
+	TestDouble(TEXT("9007199254740993"), 16, 9007199254740992.0);
+	TestDouble(TEXT(""), 0, 0.0);
+	TestDouble(TEXT(" 1"), 0, 0.0);
+	TestDouble(TEXT("-."), 0, 0.0);
+
+	double Infinity = 0.0;
+	TestEqual(TEXT("ParseDouble infinity"), UE::String::ParseDouble(TEXT("-Infinity"_SV), Infinity), 9);
+	TestTrue(TEXT("ParseDouble infinity value"), !FMath::IsFinite(Infinity) && Infinity < 0.0);
+
+	float Float = 0.0f;
+	TestEqual(TEXT("ParseFloat length"), UE::String::ParseFloat("3.4028235e38"_ASV, Float), 12);
+	TestEqual(TEXT("ParseFloat value"), Float, 3.4028235e38f);
+
+	int64 Signed = 0;
+	TestEqual(TEXT("ParseInteger signed"), UE::String::ParseInteger(TEXT("-9223372036854775808"_SV), Signed), 20);
+	TestEqual(TEXT("ParseInteger signed value"), Signed, MIN_int64);
+	TestEqual(TEXT("ParseInteger signed overflow"), UE::String::ParseInteger(TEXT("9223372036854775808"_SV), Signed), 0);
+	TestEqual(TEXT("ParseInteger hex"), UE::String::ParseInteger("0x1fz"_ASV, Signed, 16), 4);
+	TestEqual(TEXT("ParseInteger hex value"), Signed, int64(31));
+
+	uint64 Unsigned = 0;
+	TestEqual(TEXT("ParseInteger unsigned"), UE::String::ParseInteger(TEXT("18446744073709551615"_SV), Unsigned), 20);
+	TestEqual(TEXT("ParseInteger unsigned value"), Unsigned, MAX_uint64);
+	TestEqual(TEXT("ParseInteger unsigned minus"), UE::String::ParseInteger(TEXT("-1"_SV), Unsigned), 0);
+	TestEqual(TEXT("ParseInteger octal"), UE::String::ParseInteger(TEXT("017"_SV), Unsigned, 0), 3);
+	TestEqual(TEXT("ParseInteger octal value"), Unsigned, uint64(15));
+
+	// The CRT replacements skip whitespace and clamp
+	TestEqual(TEXT("Atof"), FCString::Atof(TEXT("  \t1.25xyz")), 1.25f);
+	TestEqual(TEXT("Atod"), FCStringAnsi::Atod("-1e-3"), -1e-3);
+	TestEqual(TEXT("Atod hex float"), FCString::Atod(TEXT("0x1p4")), 16.0);
+	TestEqual(TEXT("Atoi"), FCString::Atoi(TEXT(" -42abc")), -42);
+	TestEqual(TEXT("Atoi clamps"), FCString::Atoi(TEXT("99999999999")), MAX_int32);
+	TestEqual(TEXT("Strtoui64 negates"), FCString::Strtoui64(TEXT("-1"), nullptr, 10), MAX_uint64);
+
+	TCHAR* End = nullptr;
+	const TCHAR* Hex = TEXT("0x7fffffff,");
+	TestEqual(TEXT("Strtoi"), FCString::Strtoi(Hex, &End, 16), MAX_int32);
+	TestTrue(TEXT("Strtoi end"), End == Hex + 10);
+	FCString::Strtoi(TEXT("x"), &End, 10);
+	TestTrue(TEXT("Strtoi end without a number"), *End == TEXT('x'));
+
+	float LexFloat = 0.0f;
+	LexFromString(LexFloat, TEXT("  0.75 and more"_SV));
+	TestEqual(TEXT("LexFromString float view"), LexFloat, 0.75f);
+
+	uint32 LexUnsigned = 0;
+	LexFromString(LexUnsigned, TEXT("4294967295"_SV));
+	TestEqual(TEXT("LexFromString uint32 view"), LexUnsigned, MAX_uint32);
+
+	TCHAR* GuidEnd = nullptr;
+	TestEqual(TEXT("Strtoi keeps the bits of 32 bit hex values"), uint32(FCString::Strtoi(TEXT("DEADBEEF"), &GuidEnd, 16)), 0xDEADBEEFu);
+
+	// The view overloads of LexFromString convert and clamp like the null-terminated ones
+	const TCHAR* LexStrings[] =
+	{
+		TEXT("0"), TEXT(" \t-42"), TEXT("+7x"), TEXT("127"), TEXT("128"), TEXT("-129"), TEXT("65536"), TEXT("2147483648"),
+		TEXT("4294967295"), TEXT("99999999999"), TEXT("-99999999999"), TEXT("9223372036854775808"), TEXT("-9223372036854775809"),
+		TEXT("18446744073709551616"), TEXT("-1"), TEXT("0x1F"), TEXT("017"), TEXT("1.5"), TEXT("-0.1e-3"), TEXT("3.4028235e38"),
+		TEXT("1e400"), TEXT("0x1p4"), TEXT("-0x1.8p1"), TEXT("inf"), TEXT("-nan"), TEXT(""), TEXT("  "), TEXT("abc"),
+	};
+	for (const TCHAR* String : LexStrings)
+	{
+		using namespace ParseNumberTest;
+		TestTrue(FString::Printf(TEXT("LexFromString int8 agrees for \"%s\""), String), LexFromStringAgrees<int8>(String));
+		TestTrue(FString::Printf(TEXT("LexFromString int16 agrees for \"%s\""), String), LexFromStringAgrees<int16>(String));
+		TestTrue(FString::Printf(TEXT("LexFromString int32 agrees for \"%s\""), String), LexFromStringAgrees<int32>(String));
+		TestTrue(FString::Printf(TEXT("LexFromString int64 agrees for \"%s\""), String), LexFromStringAgrees<int64>(String));
+		TestTrue(FString::Printf(TEXT("LexFromString uint8 agrees for \"%s\""), String), LexFromStringAgrees<uint8>(String));
+		TestTrue(FString::Printf(TEXT("LexFromString uint16 agrees for \"%s\""), String), LexFromStringAgrees<uint16>(String));
+		TestTrue(FString::Printf(TEXT("LexFromString uint32 agrees for \"%s\""), String), LexFromStringAgrees<uint32>(String));
+		TestTrue(FString::Printf(TEXT("LexFromString uint64 agrees for \"%s\""), String), LexFromStringAgrees<uint64>(String));
+		TestTrue(FString::Printf(TEXT("LexFromString float agrees for \"%s\""), String), LexFromStringAgrees<float>(String));
+		TestTrue(FString::Printf(TEXT("LexFromString double agrees for \"%s\""), String), LexFromStringAgrees<double>(String));
+	}
+
+	int32 LexClamped = 0;
+	LexFromString(LexClamped, TEXT("99999999999"_SV));
+	TestEqual(TEXT("LexFromString int32 view clamps"), LexClamped, MAX_int32);
+	uint64 LexNegated = 0;
+	LexFromString(LexNegated, TEXT("-1"_SV));
+	TestEqual(TEXT("LexFromString uint64 view negates"), LexNegated, MAX_uint64);
+	double LexHex = 0.0;
+	LexFromString(LexHex, TEXT("0x1p4"_SV));
+	TestEqual(TEXT("LexFromString double view hex float"), LexHex, 16.0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
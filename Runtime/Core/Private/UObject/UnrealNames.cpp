@@ -662,6 +662,12 @@ public:
 	void BatchLock() const	 { Lock.WriteLock(); }
 	void BatchUnlock() const { Lock.WriteUnlock(); }
 
+	// Used during batch insertion to start fetching the first slot an upcoming name will probe
+	FORCEINLINE void BatchPrefetch(uint32 UnmaskedSlotIndex) const
+	{
+		FPlatformMisc::Prefetch(Slots + FNameHash::GetProbeStart(UnmaskedSlotIndex, CapacityMask));
+	}
+
 protected:
 	enum { LoadFactorQuotient = 9, LoadFactorDivisor = 10 }; // I.e. realloc slots when 90% full
 
@@ -834,6 +840,7 @@ public:
 	bool			IsValid(FNameEntryHandle Handle) const;
 
 	void			BatchLock();
+	void			BatchPrefetch(uint64 Hash) const;
 	FNameEntryId	BatchStore(const FNameComparisonValue& ComparisonValue);
 	void			BatchUnlock();
 
@@ -987,6 +994,13 @@ void FNamePool::BatchLock()
 	Entries.BatchLock();
 }
 
+/** @param Hash of the lowercase name, as stored in name batches */
+FORCEINLINE void FNamePool::BatchPrefetch(uint64 Hash) const
+{
+	static constexpr uint32 ShardMask = FNamePoolShards - 1;
+	ComparisonShards[static_cast<uint32>(Hash >> 32) & ShardMask].BatchPrefetch(static_cast<uint32>(Hash));
+}
+
 FORCEINLINE FNameEntryId FNamePool::BatchStore(const FNameComparisonValue& ComparisonValue)
 {
 	bool bCreatedNewEntry;
@@ -2902,15 +2916,23 @@ void LoadNameBatch(TArray<FNameEntryId>& OutNames, TArrayView<const uint8> NameD
 
 	OutNames.Empty(Hashes.Num());
 
-	GetNamePoolPostInit().BatchLock();
+	FNamePool& Pool = GetNamePoolPostInit();
+	Pool.BatchLock();
 
 	if (HashVersion == FNameHash::AlgorithmId)
 	{
-		for (uint64 Hash : Hashes)
+		// Probing mostly misses cache, prefetch the slots of upcoming names so the misses overlap
+		static constexpr int32 PrefetchDistance = 8;
+		for (int32 Idx = 0, Num = Hashes.Num(); Idx < Num; ++Idx)
 		{
+			if (Idx + PrefetchDistance < Num)
+			{
+				Pool.BatchPrefetch(INTEL_ORDER64(Hashes[Idx + PrefetchDistance]));
+			}
+
 			check(NameIt < NameEnd);
 			FNameSerializedView Name = LoadNameHeader(/* in-out */ NameIt);
-			OutNames.Add(BatchLoadNameWithHash(Name, INTEL_ORDER64(Hash)));
+			OutNames.Add(BatchLoadNameWithHash(Name, INTEL_ORDER64(Hashes[Idx])));
 		}
 	}
 	else
@@ -2923,7 +2945,7 @@ void LoadNameBatch(TArray<FNameEntryId>& OutNames, TArrayView<const uint8> NameD
 	
 	}
 
-	GetNamePoolPostInit().BatchUnlock();
+	Pool.BatchUnlock();
 
 	check(NameIt == NameEnd);
 }
@@ -35,6 +35,69 @@ struct FBitSet
 		checkSlow(NumBits >= 0);
 		return FMath::DivideAndRoundUp(static_cast<uint32>(NumBits), BitsPerWord);
 	}
+
+	/**
+	 * Returns the index of the first word in [WordIndex, NumWords) that is not equal to Test, or NumWords if there is none.
+	 * Runs of matching words are compared four at a time as a pair of 64-bit values.
+	 */
+	static FORCEINLINE uint32 SkipWords(const uint32* Words, uint32 WordIndex, uint32 NumWords, uint32 Test)
+	{
+		const uint64 TestPair = ((uint64)Test << 32) | Test;
+		for (; WordIndex + 4 <= NumWords; WordIndex += 4)
+		{
+			uint64 Pairs[2];
+			FMemory::Memcpy(Pairs, Words + WordIndex, sizeof(Pairs));
+			if (((Pairs[0] ^ TestPair) | (Pairs[1] ^ TestPair)) != 0)
+			{
+				break;
+			}
+		}
+		while (WordIndex < NumWords && Words[WordIndex] == Test)
+		{
+			++WordIndex;
+		}
+		return WordIndex;
+	}
+
+	/** Returns one past the index of the last word before EndWordIndex that is not equal to Test, or 0 if there is none. */
+	static FORCEINLINE uint32 SkipWordsBackward(const uint32* Words, uint32 EndWordIndex, uint32 Test)
+	{
+		const uint64 TestPair = ((uint64)Test << 32) | Test;
+		for (; EndWordIndex >= 4; EndWordIndex -= 4)
+		{
+			uint64 Pairs[2];
+			FMemory::Memcpy(Pairs, Words + EndWordIndex - 4, sizeof(Pairs));
+			if (((Pairs[0] ^ TestPair) | (Pairs[1] ^ TestPair)) != 0)
+			{
+				break;
+			}
+		}
+		while (EndWordIndex > 0 && Words[EndWordIndex - 1] == Test)
+		{
+			--EndWordIndex;
+		}
+		return EndWordIndex;
+	}
+
+	/** Counts the set bits in the words, using a 64-bit population count per pair of words. */
+	static FORCEINLINE int32 CountSetBits(const uint32* Words, uint32 NumWords)
+	{
+		int32 Count0 = 0;
+		int32 Count1 = 0;
+		uint32 WordIndex = 0;
+		for (; WordIndex + 4 <= NumWords; WordIndex += 4)
+		{
+			uint64 Pairs[2];
+			FMemory::Memcpy(Pairs, Words + WordIndex, sizeof(Pairs));
+			Count0 += FMath::CountBits(Pairs[0]);
+			Count1 += FMath::CountBits(Pairs[1]);
+		}
+		for (; WordIndex < NumWords; ++WordIndex)
+		{
+			Count0 += FMath::CountBits((uint64)Words[WordIndex]);
+		}
+		return Count0 + Count1;
+	}
 };
 
 
@@ -957,11 +1020,7 @@ public:
 		const uint32* RESTRICT DwordArray = GetData();
 		const int32 LocalNumBits = NumBits;
 		const int32 DwordCount = FBitSet::CalculateNumWords(LocalNumBits);
-		int32 DwordIndex = 0;
-		while (DwordIndex < DwordCount && DwordArray[DwordIndex] == Test)
-		{
-			++DwordIndex;
-		}
+		const int32 DwordIndex = (int32)FBitSet::SkipWords(DwordArray, 0, DwordCount, Test);
 
 		if (DwordIndex < DwordCount)
 		{
@@ -985,26 +1044,27 @@ public:
 	int32 FindLast(bool bValue) const 
 	{
 		const int32 LocalNumBits = NumBits;
+		if (LocalNumBits == 0)
+		{
+			return INDEX_NONE;
+		}
 
 		// Get the correct mask for the last word
 		uint32 SlackIndex = ((LocalNumBits - 1) % NumBitsPerDWORD) + 1;
 		uint32 Mask = ~0u >> (NumBitsPerDWORD - SlackIndex);
 
-		// Iterate over the array until we see a word with a zero bit.
-		uint32 DwordIndex = FBitSet::CalculateNumWords(LocalNumBits);
+		// Check the last word, then iterate backwards over the array until we see a word with a matching bit.
+		uint32 DwordIndex = FBitSet::CalculateNumWords(LocalNumBits) - 1;
 		const uint32* RESTRICT DwordArray = GetData();
 		const uint32 Test = bValue ? 0u : ~0u;
-		for (;;)
+		if ((DwordArray[DwordIndex] & Mask) == (Test & Mask))
 		{
+			DwordIndex = FBitSet::SkipWordsBackward(DwordArray, DwordIndex, Test);
 			if (DwordIndex == 0)
 			{
 				return INDEX_NONE;
 			}
 			--DwordIndex;
-			if ((DwordArray[DwordIndex] & Mask) != (Test & Mask))
-			{
-				break;
-			}
 			Mask = ~0u;
 		}
 
@@ -1033,11 +1093,7 @@ public:
 		uint32* RESTRICT DwordArray = GetData();
 		const int32 LocalNumBits = NumBits;
 		const int32 DwordCount = FBitSet::CalculateNumWords(LocalNumBits);
-		int32 DwordIndex = FMath::DivideAndRoundDown(ConservativeStartIndex, NumBitsPerDWORD);
-		while (DwordIndex < DwordCount && DwordArray[DwordIndex] == (uint32)-1)
-		{
-			++DwordIndex;
-		}
+		const int32 DwordIndex = (int32)FBitSet::SkipWords(DwordArray, FMath::DivideAndRoundDown(ConservativeStartIndex, NumBitsPerDWORD), DwordCount, (uint32)-1);
 
 		if (DwordIndex < DwordCount)
 		{
@@ -1064,25 +1120,26 @@ public:
 	int32 FindAndSetLastZeroBit()
 	{
 		const int32 LocalNumBits = NumBits;
+		if (LocalNumBits == 0)
+		{
+			return INDEX_NONE;
+		}
 
 		// Get the correct mask for the last word
 		uint32 SlackIndex = ((LocalNumBits - 1) % NumBitsPerDWORD) + 1;
 		uint32 Mask = ~0u >> (NumBitsPerDWORD - SlackIndex);
 
-		// Iterate over the array until we see a word with a zero bit.
-		uint32 DwordIndex = FBitSet::CalculateNumWords(LocalNumBits);
+		// Check the last word, then iterate backwards over the array until we see a word with a zero bit.
+		uint32 DwordIndex = FBitSet::CalculateNumWords(LocalNumBits) - 1;
 		uint32* RESTRICT DwordArray = GetData();
-		for (;;)
+		if ((DwordArray[DwordIndex] & Mask) == Mask)
 		{
+			DwordIndex = FBitSet::SkipWordsBackward(DwordArray, DwordIndex, ~0u);
 			if (DwordIndex == 0)
 			{
 				return INDEX_NONE;
 			}
 			--DwordIndex;
-			if ((DwordArray[DwordIndex] & Mask) != Mask)
-			{
-				break;
-			}
 			Mask = ~0u;
 		}
 
@@ -1164,10 +1221,13 @@ public:
 	 */
 	void BitwiseNOT()
 	{
-		for (FDWORDIterator It(*this); It; ++It)
+		uint32* RESTRICT Data = GetData();
+		const uint32 NumWords = GetNumWords();
+		for (uint32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
 		{
-			It.SetDWORD(~It.GetDWORD());
+			Data[WordIndex] = ~Data[WordIndex];
 		}
+		ClearPartialSlackBits();
 	}
 
 	/**
@@ -1183,12 +1243,48 @@ public:
 		checkSlow(FromIndex >= 0);
 		checkSlow(ToIndex >= FromIndex && ToIndex <= NumBits);
 
-		int32 NumSetBits = 0;
-		for (FConstDWORDIterator It(*this, FromIndex, ToIndex); It; ++It)
+		if (FromIndex == ToIndex)
 		{
-			NumSetBits += FMath::CountBits(It.GetDWORD());
+			return 0;
+		}
+
+		// Mask the partial words at either end, and count the whole words between them in bulk
+		const uint32* Data = GetData();
+		const uint32 FirstWordIndex = (uint32)FromIndex / NumBitsPerDWORD;
+		const uint32 LastWordIndex = (uint32)(ToIndex - 1) / NumBitsPerDWORD;
+		const uint32 FirstMask = FullWordMask << ((uint32)FromIndex % NumBitsPerDWORD);
+		const uint32 LastMask = FullWordMask >> ((NumBitsPerDWORD - (uint32)ToIndex % NumBitsPerDWORD) % NumBitsPerDWORD);
+		if (FirstWordIndex == LastWordIndex)
+		{
+			return FMath::CountBits((uint64)(Data[FirstWordIndex] & FirstMask & LastMask));
+		}
+
+		return FMath::CountBits((uint64)(Data[FirstWordIndex] & FirstMask))
+			+ FBitSet::CountSetBits(Data + FirstWordIndex + 1, LastWordIndex - FirstWordIndex - 1)
+			+ FMath::CountBits((uint64)(Data[LastWordIndex] & LastMask));
+	}
+
+	/**
+	 * Calls Func with the index of each set bit in ascending order. This is faster than TConstSetBitIterator for visiting
+	 * every set bit of a large, sparse array. Func must not modify the array.
+	 */
+	template <typename FuncType>
+	void ForEachSetBit(FuncType&& Func) const
+	{
+		const uint32* Data = GetData();
+		const uint32 NumWords = GetNumWords();
+		for (uint32 WordIndex = FBitSet::SkipWords(Data, 0, NumWords, 0); WordIndex < NumWords; WordIndex = FBitSet::SkipWords(Data, WordIndex + 1, NumWords, 0))
+		{
+			// The slack bits past NumBits are always zero, so the last word doesn't need masking
+			const int32 BaseIndex = (int32)(WordIndex * NumBitsPerDWORD);
+			uint32 Word = Data[WordIndex];
+			do
+			{
+				Func(BaseIndex + (int32)FMath::CountTrailingZeros(Word));
+				Word &= Word - 1;
+			}
+			while (Word);
 		}
-		return NumSetBits;
 	}
 
 	/**
@@ -1436,16 +1532,7 @@ private:
 				OutResult.Reserve(MinNumBits);
 				OutResult.NumBits = MinNumBits;
 
-				FConstDWORDIterator IteratorA(InA);
-				FConstDWORDIterator IteratorB(InB);
-
-				FDWORDIterator IteratorResult(OutResult);
-
-				for ( ; IteratorResult; ++IteratorResult, ++IteratorA, ++IteratorB)
-				{
-					const uint32 NewValue = Invoke(InProjection, IteratorA.GetDWORD(), IteratorB.GetDWORD());
-					IteratorResult.SetDWORD(NewValue);
-				}
+				CombineWords(OutResult, InA, InB, 0, InProjection);
 			}
 
 		}
@@ -1460,21 +1547,7 @@ private:
 				OutResult.Reserve(MaxNumBits);
 				OutResult.NumBits = MaxNumBits;
 
-				FConstDWORDIterator IteratorA(InA);
-				FConstDWORDIterator IteratorB(InB);
-
-				IteratorA.FillMissingBits(MissingBitsFill);
-				IteratorB.FillMissingBits(MissingBitsFill);
-
-				FDWORDIterator IteratorResult(OutResult);
-
-				for ( ; IteratorResult; ++IteratorResult, ++IteratorA, ++IteratorB)
-				{
-					uint32 A = IteratorA ? IteratorA.GetDWORD() : MissingBitsFill;
-					uint32 B = IteratorB ? IteratorB.GetDWORD() : MissingBitsFill;
-
-					IteratorResult.SetDWORD(Invoke(InProjection, A, B));
-				}
+				CombineWords(OutResult, InA, InB, MissingBitsFill, InProjection);
 			}
 
 		}
@@ -1517,19 +1590,54 @@ private:
 		const uint32 MissingBitsFill = EnumHasAnyFlags(InFlags, EBitwiseOperatorFlags::OneFillMissingBits) ? ~0u : 0;
 		if (OutResult.NumBits != 0)
 		{
-			FConstDWORDIterator IteratorOther(InOther);
-			IteratorOther.FillMissingBits(MissingBitsFill);
+			CombineWords(OutResult, OutResult, InOther, MissingBitsFill, InProjection);
+		}
+
+		OutResult.CheckInvariants();
+	}
+
+	/**
+	 * Sets each word of OutResult to the projection of the words of InA and InB, where bits past the end of either operand
+	 * read as MissingBitsFill. The words that are whole in both operands are combined in a plain loop the compiler can
+	 * vectorize, and only the words at the ends of the operands are masked. OutResult may be InA.
+	 */
+	template<typename ProjectionType>
+	static void CombineWords(TBitArray& OutResult, const TBitArray& InA, const TBitArray& InB, uint32 MissingBitsFill, ProjectionType&& InProjection)
+	{
+		uint32* Result = OutResult.GetData();
+		const uint32* DataA = InA.GetData();
+		const uint32* RESTRICT DataB = InB.GetData();
 
-			FDWORDIterator IteratorResult(OutResult);
+		const uint32 NumWords = OutResult.GetNumWords();
+		const uint32 NumWholeWords = FMath::Min3(NumWords, (uint32)InA.Num() / NumBitsPerDWORD, (uint32)InB.Num() / NumBitsPerDWORD);
 
-			for ( ; IteratorResult; ++IteratorResult, ++IteratorOther)
+		for (uint32 WordIndex = 0; WordIndex < NumWholeWords; ++WordIndex)
+		{
+			Result[WordIndex] = Invoke(InProjection, DataA[WordIndex], DataB[WordIndex]);
+		}
+
+		auto GetWord = [MissingBitsFill](const uint32* Data, int32 DataNumBits, uint32 WordIndex) -> uint32
+		{
+			const uint32 NumValidBits = (uint32)FMath::Clamp<int32>(DataNumBits - (int32)(WordIndex * NumBitsPerDWORD), 0, NumBitsPerDWORD);
+			if (NumValidBits == (uint32)NumBitsPerDWORD)
+			{
+				return Data[WordIndex];
+			}
+			if (NumValidBits == 0)
 			{
-				const uint32 OtherValue = IteratorOther ? IteratorOther.GetDWORD() : MissingBitsFill;
-				IteratorResult.SetDWORD(Invoke(InProjection, IteratorResult.GetDWORD(), OtherValue));
+				return MissingBitsFill;
 			}
+
+			// The slack bits of the last word are always zero, so they only need filling
+			return Data[WordIndex] | (MissingBitsFill & (FullWordMask << NumValidBits));
+		};
+
+		for (uint32 WordIndex = NumWholeWords; WordIndex < NumWords; ++WordIndex)
+		{
+			Result[WordIndex] = Invoke(InProjection, GetWord(DataA, InA.Num(), WordIndex), GetWord(DataB, InB.Num(), WordIndex));
 		}
 
-		OutResult.CheckInvariants();
+		OutResult.ClearPartialSlackBits();
 	}
 
 
@@ -1825,12 +1933,11 @@ private:
 		const int32   ArrayNum       = Array.Num();
 		const int32   LastDWORDIndex = (ArrayNum - 1) / NumBitsPerDWORD;
 
-		// Advance to the next non-zero uint32.
+		// Advance to the next non-zero uint32, skipping runs of empty words in bulk.
 		uint32 RemainingBitMask = ArrayData[this->DWORDIndex] & UnvisitedBitMask;
-		while (!RemainingBitMask)
+		if (!RemainingBitMask)
 		{
-			++this->DWORDIndex;
-			BaseBitIndex += NumBitsPerDWORD;
+			this->DWORDIndex = (int32)FBitSet::SkipWords(ArrayData, this->DWORDIndex + 1, LastDWORDIndex + 1, 0);
 			if (this->DWORDIndex > LastDWORDIndex)
 			{
 				// We've advanced past the end of the array.
@@ -1838,6 +1945,7 @@ private:
 				return;
 			}
 
+			BaseBitIndex = this->DWORDIndex * NumBitsPerDWORD;
 			RemainingBitMask = ArrayData[this->DWORDIndex];
 			UnvisitedBitMask = ~0;
 		}
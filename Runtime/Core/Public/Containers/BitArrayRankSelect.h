@@ -0,0 +1,130 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Algo/BinarySearch.h"
+#include "Containers/Array.h"
+#include "Containers/BitArray.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/AssertionMacros.h"
+
+/**
+ * Rank and select queries over the bits of a TBitArray, for mapping between bit indices and dense indices of set bits,
+ * such as the index of an allocated element among only the allocated elements.
+ *
+ * Rank(Index) returns the number of set bits before Index, and Select(Rank) returns the index of the set bit with that
+ * rank. The index stores the number of set bits before each 512 bit block, which costs 1/16 of the size of the bits, so
+ * Rank counts at most one block with 64-bit population counts and Select binary searches the blocks before doing so.
+ *
+ * The index refers to the words of the bit array it was built from, which must outlive it and not be modified or resized
+ * until the index is rebuilt.
+ */
+class FBitArrayRankSelect
+{
+public:
+	FBitArrayRankSelect()
+		: Words(nullptr)
+		, NumBits(0)
+	{
+		BlockRanks.Add(0);
+	}
+
+	template <typename Allocator>
+	explicit FBitArrayRankSelect(const TBitArray<Allocator>& BitArray)
+	{
+		Build(BitArray);
+	}
+
+	/** Rebuilds the index for the current bits of BitArray. */
+	template <typename Allocator>
+	void Build(const TBitArray<Allocator>& BitArray)
+	{
+		Words = BitArray.GetData();
+		NumBits = BitArray.Num();
+
+		const uint32 NumWords = FBitSet::CalculateNumWords(NumBits);
+		const uint32 NumBlocks = FMath::DivideAndRoundUp(NumWords, WordsPerBlock);
+
+		BlockRanks.Reset(NumBlocks + 1);
+		int32 NumSetBits = 0;
+		for (uint32 BlockIndex = 0; BlockIndex < NumBlocks; ++BlockIndex)
+		{
+			BlockRanks.Add(NumSetBits);
+			const uint32 FirstWordIndex = BlockIndex * WordsPerBlock;
+			NumSetBits += FBitSet::CountSetBits(Words + FirstWordIndex, FMath::Min(WordsPerBlock, NumWords - FirstWordIndex));
+		}
+		BlockRanks.Add(NumSetBits);
+	}
+
+	/** The number of bits in the bit array when the index was built. */
+	FORCEINLINE int32 Num() const
+	{
+		return NumBits;
+	}
+
+	/** The number of set bits in the bit array when the index was built. */
+	FORCEINLINE int32 CountSetBits() const
+	{
+		return BlockRanks.Last();
+	}
+
+	/** Returns the number of set bits before Index, where 0 <= Index <= Num(). */
+	int32 Rank(int32 Index) const
+	{
+		checkSlow(Index >= 0 && Index <= NumBits);
+
+		const uint32 BlockIndex = (uint32)Index / BitsPerBlock;
+		const uint32 WordIndex = (uint32)Index / NumBitsPerDWORD;
+		const uint32 BitOffset = (uint32)Index % NumBitsPerDWORD;
+
+		int32 Result = BlockRanks[BlockIndex] + FBitSet::CountSetBits(Words + BlockIndex * WordsPerBlock, WordIndex - BlockIndex * WordsPerBlock);
+		if (BitOffset != 0)
+		{
+			Result += FMath::CountBits((uint64)(Words[WordIndex] & ~(~0u << BitOffset)));
+		}
+		return Result;
+	}
+
+	/** Returns the index of the set bit with Rank set bits before it, or INDEX_NONE if Rank >= CountSetBits(). */
+	int32 Select(int32 InRank) const
+	{
+		if (InRank < 0 || InRank >= CountSetBits())
+		{
+			return INDEX_NONE;
+		}
+
+		// The last block starting at or before the bit, then the word containing it
+		const uint32 BlockIndex = (uint32)Algo::UpperBound(BlockRanks, InRank) - 1;
+		int32 Remaining = InRank - BlockRanks[BlockIndex];
+		for (uint32 WordIndex = BlockIndex * WordsPerBlock; ; ++WordIndex)
+		{
+			uint32 Word = Words[WordIndex];
+			const int32 NumSetBitsInWord = FMath::CountBits((uint64)Word);
+			if (Remaining < NumSetBitsInWord)
+			{
+				for (; Remaining > 0; --Remaining)
+				{
+					Word &= Word - 1;
+				}
+				return (int32)(WordIndex * NumBitsPerDWORD + FMath::CountTrailingZeros(Word));
+			}
+			Remaining -= NumSetBitsInWord;
+		}
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		return BlockRanks.GetAllocatedSize();
+	}
+
+private:
+	static constexpr uint32 WordsPerBlock = 16;
+	static constexpr uint32 BitsPerBlock = WordsPerBlock * NumBitsPerDWORD;
+
+	const uint32* Words;
+	int32 NumBits;
+
+	/** The number of set bits before each block, followed by the total */
+	TArray<int32> BlockRanks;
+};
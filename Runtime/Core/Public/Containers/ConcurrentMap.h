@@ -0,0 +1,282 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Async/ParallelFor.h"
+#include "Containers/ArrayView.h"
+#include "Containers/Map.h"
+#include "Misc/ScopeRWLock.h"
+#include "Templates/UnrealTemplate.h"
+
+/*
+Implements a thread-safe map by striping the keys over a fixed number of shards, each a TMap guarded by its own FRWLock.
+
+Lookups only take a shared lock on one shard, so readers never wait on each other and writers only block the threads
+touching the same shard. Values are never handed out by reference since another thread could remove or rehash them
+once the shard lock is released. Find copies the value out, and the Apply functions run a callback while the shard
+is locked.
+*/
+template<typename KeyType, typename ValueType, uint32 NumShards = 64>
+class TConcurrentMap
+{
+	static_assert(NumShards > 0 && (NumShards & (NumShards - 1)) == 0, "NumShards must be a power of two");
+
+public:
+	using KeyInitType = typename TTypeTraits<KeyType>::ConstInitType;
+	using ValueInitType = typename TTypeTraits<ValueType>::ConstInitType;
+	using MapType = TMap<KeyType, ValueType>;
+
+	TConcurrentMap() = default;
+	TConcurrentMap(const TConcurrentMap&) = delete;
+	TConcurrentMap& operator=(const TConcurrentMap&) = delete;
+
+	/** Returns the number of pairs, only a snapshot while other threads modify the map */
+	int32 Num() const
+	{
+		int32 Count = 0;
+		for (const FShard& Shard : Shards)
+		{
+			FRWScopeLock ScopeLock(Shard.Lock, SLT_ReadOnly);
+			Count += Shard.Map.Num();
+		}
+		return Count;
+	}
+
+	/** Returns true and sets OutValue to the value associated with the key if it exists */
+	bool Find(KeyInitType Key, ValueType& OutValue) const
+	{
+		const uint32 KeyHash = GetTypeHash(Key);
+		const FShard& Shard = GetShard(KeyHash);
+		FRWScopeLock ScopeLock(Shard.Lock, SLT_ReadOnly);
+		if (const ValueType* Value = Shard.Map.FindByHash(KeyHash, Key))
+		{
+			OutValue = *Value;
+			return true;
+		}
+		return false;
+	}
+
+	/** Returns a copy of the value associated with the key, or a default constructed value if it isn't in the map */
+	ValueType FindRef(KeyInitType Key) const
+	{
+		ValueType Value = ValueType();
+		Find(Key, Value);
+		return Value;
+	}
+
+	bool Contains(KeyInitType Key) const
+	{
+		const uint32 KeyHash = GetTypeHash(Key);
+		const FShard& Shard = GetShard(KeyHash);
+		FRWScopeLock ScopeLock(Shard.Lock, SLT_ReadOnly);
+		return Shard.Map.FindByHash(KeyHash, Key) != nullptr;
+	}
+
+	/**
+	 * Calls Func with a const reference to the value associated with the key while its shard is read locked.
+	 * Func must not access this map.
+	 *
+	 * @return true if the key was found
+	 */
+	template<typename FuncType>
+	bool FindAndApply(KeyInitType Key, FuncType&& Func) const
+	{
+		const uint32 KeyHash = GetTypeHash(Key);
+		const FShard& Shard = GetShard(KeyHash);
+		FRWScopeLock ScopeLock(Shard.Lock, SLT_ReadOnly);
+		if (const ValueType* Value = Shard.Map.FindByHash(KeyHash, Key))
+		{
+			Func(*Value);
+			return true;
+		}
+		return false;
+	}
+
+	/** Sets the value associated with the key, replacing an existing pair with the same key */
+	FORCEINLINE void Add(KeyInitType Key, const ValueType& Value) { AddImpl(Key, Value); }
+	FORCEINLINE void Add(KeyInitType Key,       ValueType&& Value) { AddImpl(Key, MoveTemp(Value)); }
+
+	/**
+	 * Adds many pairs at once, taking the lock of each touched shard only once.
+	 * Later pairs replace earlier ones with the same key.
+	 */
+	void Append(TArrayView<const TPair<KeyType, ValueType>> Pairs)
+	{
+		// Bucket the pairs by shard, keeping their order within each shard
+		TArray<uint32, TInlineAllocator<256>> KeyHashes;
+		TArray<int32, TInlineAllocator<256>> SortedPairIndices;
+		int32 ShardStarts[NumShards + 1] = {};
+		KeyHashes.Reserve(Pairs.Num());
+		for (const TPair<KeyType, ValueType>& Pair : Pairs)
+		{
+			const uint32 KeyHash = GetTypeHash(Pair.Key);
+			KeyHashes.Add(KeyHash);
+			++ShardStarts[GetShardIndex(KeyHash) + 1];
+		}
+		for (uint32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+		{
+			ShardStarts[ShardIndex + 1] += ShardStarts[ShardIndex];
+		}
+		SortedPairIndices.SetNumUninitialized(Pairs.Num());
+		{
+			int32 ShardEnds[NumShards];
+			FMemory::Memcpy(ShardEnds, ShardStarts, sizeof(ShardEnds));
+			for (int32 PairIndex = 0; PairIndex < Pairs.Num(); ++PairIndex)
+			{
+				SortedPairIndices[ShardEnds[GetShardIndex(KeyHashes[PairIndex])]++] = PairIndex;
+			}
+		}
+
+		for (uint32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+		{
+			if (ShardStarts[ShardIndex] == ShardStarts[ShardIndex + 1])
+			{
+				continue;
+			}
+
+			FShard& Shard = Shards[ShardIndex];
+			FRWScopeLock ScopeLock(Shard.Lock, SLT_Write);
+			for (int32 SortedIndex = ShardStarts[ShardIndex]; SortedIndex < ShardStarts[ShardIndex + 1]; ++SortedIndex)
+			{
+				const int32 PairIndex = SortedPairIndices[SortedIndex];
+				Shard.Map.AddByHash(KeyHashes[PairIndex], Pairs[PairIndex].Key, Pairs[PairIndex].Value);
+			}
+		}
+	}
+
+	/**
+	 * Finds the value associated with the key, or adds one constructed by calling ConstructFunc() if there is none,
+	 * and returns a copy of it. ConstructFunc is called with the shard write locked, so another thread adding the same
+	 * key concurrently waits for it rather than constructing a second value, and it must not access this map.
+	 */
+	template<typename ConstructFuncType>
+	ValueType FindOrAdd(KeyInitType Key, ConstructFuncType&& ConstructFunc)
+	{
+		ValueType Result = ValueType();
+
+		// Most calls find an existing value, only take the write lock when they don't
+		if (!Find(Key, Result))
+		{
+			FindOrAddAndApply(Key, Forward<ConstructFuncType>(ConstructFunc), [&Result](ValueType& Value) { Result = Value; });
+		}
+		return Result;
+	}
+
+	/**
+	 * Like FindOrAdd, but calls Func with a reference to the found or added value while its shard is write locked
+	 * instead of copying it out. Func must not access this map.
+	 *
+	 * @return true if the value was added
+	 */
+	template<typename ConstructFuncType, typename FuncType>
+	bool FindOrAddAndApply(KeyInitType Key, ConstructFuncType&& ConstructFunc, FuncType&& Func)
+	{
+		const uint32 KeyHash = GetTypeHash(Key);
+		FShard& Shard = GetShard(KeyHash);
+		FRWScopeLock ScopeLock(Shard.Lock, SLT_Write);
+		if (ValueType* Value = Shard.Map.FindByHash(KeyHash, Key))
+		{
+			Func(*Value);
+			return false;
+		}
+		// Construct exactly a ValueType, like AddImpl, so AddByHash never picks an overload for a convertible result
+		ValueType& Value = Shard.Map.AddByHash(KeyHash, Key, ValueType(ConstructFunc()));
+		Func(Value);
+		return true;
+	}
+
+	/** Returns the number of pairs removed */
+	int32 Remove(KeyInitType Key)
+	{
+		const uint32 KeyHash = GetTypeHash(Key);
+		FShard& Shard = GetShard(KeyHash);
+		FRWScopeLock ScopeLock(Shard.Lock, SLT_Write);
+		return Shard.Map.RemoveByHash(KeyHash, Key);
+	}
+
+	/** Removes all pairs */
+	void Empty()
+	{
+		for (FShard& Shard : Shards)
+		{
+			FRWScopeLock ScopeLock(Shard.Lock, SLT_Write);
+			Shard.Map.Empty();
+		}
+	}
+
+	/**
+	 * Calls Func(const KeyType&, const ValueType&) for every pair, one shard at a time with the shard read locked.
+	 * Pairs added or removed by other threads during the iteration may or may not be visited.
+	 */
+	template<typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		for (const FShard& Shard : Shards)
+		{
+			FRWScopeLock ScopeLock(Shard.Lock, SLT_ReadOnly);
+			for (const TPair<KeyType, ValueType>& Pair : Shard.Map)
+			{
+				Func(Pair.Key, Pair.Value);
+			}
+		}
+	}
+
+	/** Like ForEach, but visits the shards in parallel so Func must be thread-safe */
+	template<typename FuncType>
+	void ParallelForEach(FuncType&& Func) const
+	{
+		ParallelFor(NumShards, [this, &Func](int32 ShardIndex)
+		{
+			const FShard& Shard = Shards[ShardIndex];
+			FRWScopeLock ScopeLock(Shard.Lock, SLT_ReadOnly);
+			for (const TPair<KeyType, ValueType>& Pair : Shard.Map)
+			{
+				Func(Pair.Key, Pair.Value);
+			}
+		});
+	}
+
+private:
+	/** Takes exactly ValueType so that AddByHash never has to pick an overload for a convertible value type */
+	template<typename InitValueType>
+	void AddImpl(KeyInitType Key, InitValueType&& Value)
+	{
+		static_assert(TIsSame<typename TDecay<InitValueType>::Type, ValueType>::Value, "AddImpl must be called with a ValueType");
+
+		const uint32 KeyHash = GetTypeHash(Key);
+		FShard& Shard = GetShard(KeyHash);
+		FRWScopeLock ScopeLock(Shard.Lock, SLT_Write);
+		Shard.Map.AddByHash(KeyHash, Key, Forward<InitValueType>(Value));
+	}
+
+	/**
+	 * Each shard on its own cache lines so threads working on different shards don't contend.
+	 * The alignment is only honoured for maps that are globals or on the stack, operator new doesn't pass over-alignment
+	 * to the allocator before C++17, so the trailing padding keeps neighbouring shards apart when the map is on the heap.
+	 */
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+	{
+		mutable FRWLock Lock;
+		MapType Map;
+		uint8 Padding[PLATFORM_CACHE_LINE_SIZE];
+	};
+
+	static FORCEINLINE uint32 GetShardIndex(uint32 KeyHash)
+	{
+		// TMap buckets use the low bits of the hash, pick the shard from the high bits of a mixed hash
+		return uint32((uint64(KeyHash) * 0x9E3779B97F4A7C15ull) >> 32) & (NumShards - 1);
+	}
+
+	FORCEINLINE FShard& GetShard(uint32 KeyHash)
+	{
+		return Shards[GetShardIndex(KeyHash)];
+	}
+
+	FORCEINLINE const FShard& GetShard(uint32 KeyHash) const
+	{
+		return Shards[GetShardIndex(KeyHash)];
+	}
+
+	FShard Shards[NumShards];
+};
@@ -0,0 +1,254 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Algo/StableSort.h"
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "HAL/PlatformMath.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/AssertionMacros.h"
+#include "Serialization/Archive.h"
+#include "Templates/Less.h"
+#include "Templates/Tuple.h"
+#include "Templates/UnrealTemplate.h"
+
+namespace FrozenMap_Private
+{
+	/**
+	 * Finds the index of Key in keys laid out in Eytzinger order, where the children of the key at index I are at 2I+1
+	 * and 2I+2. The search walks down from the root like a binary search, but the keys visited by the next few steps
+	 * share a cache line, and the sibling keys of each level are next to each other. Returns INDEX_NONE if not found.
+	 */
+	template <typename KeyType, typename SortPredicate>
+	FORCEINLINE int32 FindIndex(const KeyType* Keys, int32 Num, const KeyType& Key, const SortPredicate& Predicate)
+	{
+		// Descendants four levels down occupy 16 consecutive keys, prefetch them while comparing the current levels
+		constexpr uint32 PrefetchLevels = 4;
+
+		uint32 Position = 1;
+		while (Position <= uint32(Num))
+		{
+			FPlatformMisc::Prefetch((const void*)(UPTRINT(Keys) + ((UPTRINT(Position) << PrefetchLevels) - 1) * sizeof(KeyType)));
+			Position = 2 * Position + uint32(Predicate(Keys[Position - 1], Key));
+		}
+
+		// Undo the turns to the right made after the last turn to the left, which went to the first key not less than Key
+		Position >>= FPlatformMath::CountTrailingZeros(~Position) + 1;
+		if (Position == 0 || Predicate(Key, Keys[Position - 1]))
+		{
+			return INDEX_NONE;
+		}
+		return int32(Position - 1);
+	}
+
+	/** Copies the sorted pairs to the keys and values in Eytzinger order, returning the next sorted index to copy */
+	template <typename KeyType, typename ValueType>
+	int32 Layout(TArray<TPair<KeyType, ValueType>>& SortedPairs, KeyType* Keys, ValueType* Values, int32 SortedIndex, int32 Index)
+	{
+		const int32 Num = SortedPairs.Num();
+		if (Index < Num)
+		{
+			SortedIndex = Layout(SortedPairs, Keys, Values, SortedIndex, 2 * Index + 1);
+			new (Keys + Index) KeyType(MoveTemp(SortedPairs[SortedIndex].Key));
+			new (Values + Index) ValueType(MoveTemp(SortedPairs[SortedIndex].Value));
+			SortedIndex = Layout(SortedPairs, Keys, Values, SortedIndex + 1, 2 * Index + 2);
+		}
+		return SortedIndex;
+	}
+}
+
+/**
+ * A non-owning view of a frozen map, for keys and values that live elsewhere, such as a region of a memory mapped file
+ * that was written from the arrays of a TFrozenMap. See TFrozenMap for details.
+ */
+template <typename KeyType, typename ValueType, typename SortPredicate = TLess<KeyType>>
+class TFrozenMapView
+{
+public:
+	TFrozenMapView() = default;
+
+	/** Constructs a view of keys in the layout of TFrozenMap::GetKeys, and the matching values */
+	TFrozenMapView(TArrayView<const KeyType> InKeys, TArrayView<const ValueType> InValues)
+		: Keys(InKeys)
+		, Values(InValues)
+	{
+		check(Keys.Num() == Values.Num());
+	}
+
+	FORCEINLINE int32 Num() const
+	{
+		return Keys.Num();
+	}
+
+	FORCEINLINE const ValueType* Find(const KeyType& Key) const
+	{
+		const int32 Index = FrozenMap_Private::FindIndex(Keys.GetData(), Keys.Num(), Key, SortPredicate());
+		return Index != INDEX_NONE ? Values.GetData() + Index : nullptr;
+	}
+
+	FORCEINLINE bool Contains(const KeyType& Key) const
+	{
+		return FrozenMap_Private::FindIndex(Keys.GetData(), Keys.Num(), Key, SortPredicate()) != INDEX_NONE;
+	}
+
+	FORCEINLINE const ValueType& FindChecked(const KeyType& Key) const
+	{
+		const ValueType* Value = Find(Key);
+		check(Value);
+		return *Value;
+	}
+
+	FORCEINLINE ValueType FindRef(const KeyType& Key) const
+	{
+		const ValueType* Value = Find(Key);
+		return Value ? *Value : ValueType();
+	}
+
+	/** The keys in Eytzinger order, matching GetValues by index */
+	FORCEINLINE TArrayView<const KeyType> GetKeys() const
+	{
+		return Keys;
+	}
+
+	/** The values in the order of GetKeys */
+	FORCEINLINE TArrayView<const ValueType> GetValues() const
+	{
+		return Values;
+	}
+
+private:
+	TArrayView<const KeyType> Keys;
+	TArrayView<const ValueType> Values;
+};
+
+/**
+ * An immutable map built once from an array of pairs, for large lookup tables that are loaded once and queried often.
+ *
+ * Keys and values are stored in two arrays with no per-element overhead, about half the memory of TMap. The keys are
+ * laid out in the implicit binary tree order of an Eytzinger layout, so finding is O(Log n) like TSortedMap but with
+ * far fewer cache misses on large tables, and the values are only touched once the key is found.
+ *
+ * The layout is position independent, so serializing the map writes the arrays as they are and loading doesn't need
+ * to sort or hash anything. With trivially serializable keys and values the arrays can also be written in bulk and
+ * accessed in place through a TFrozenMapView. Iterating GetKeys and GetValues visits the pairs in no particular order.
+ */
+template <typename KeyType, typename ValueType, typename SortPredicate = TLess<KeyType>>
+class TFrozenMap
+{
+public:
+	using ElementType = TPair<KeyType, ValueType>;
+
+	TFrozenMap() = default;
+	TFrozenMap(TFrozenMap&&) = default;
+	TFrozenMap(const TFrozenMap&) = default;
+	TFrozenMap& operator=(TFrozenMap&&) = default;
+	TFrozenMap& operator=(const TFrozenMap&) = default;
+
+	/** Builds the map from pairs in any order. If a key appears more than once the last of its pairs is kept, like TMap::Add. */
+	explicit TFrozenMap(TArray<ElementType>&& Pairs)
+	{
+		Build(MoveTemp(Pairs));
+	}
+
+	explicit TFrozenMap(TArrayView<const ElementType> Pairs)
+	{
+		Build(TArray<ElementType>(Pairs.GetData(), Pairs.Num()));
+	}
+
+	FORCEINLINE int32 Num() const
+	{
+		return Keys.Num();
+	}
+
+	FORCEINLINE SIZE_T GetAllocatedSize() const
+	{
+		return Keys.GetAllocatedSize() + Values.GetAllocatedSize();
+	}
+
+	FORCEINLINE const ValueType* Find(const KeyType& Key) const
+	{
+		return GetView().Find(Key);
+	}
+
+	FORCEINLINE bool Contains(const KeyType& Key) const
+	{
+		return GetView().Contains(Key);
+	}
+
+	FORCEINLINE const ValueType& FindChecked(const KeyType& Key) const
+	{
+		return GetView().FindChecked(Key);
+	}
+
+	FORCEINLINE ValueType FindRef(const KeyType& Key) const
+	{
+		return GetView().FindRef(Key);
+	}
+
+	/** The keys in Eytzinger order, matching GetValues by index */
+	FORCEINLINE TArrayView<const KeyType> GetKeys() const
+	{
+		return Keys;
+	}
+
+	/** The values in the order of GetKeys */
+	FORCEINLINE TArrayView<const ValueType> GetValues() const
+	{
+		return Values;
+	}
+
+	FORCEINLINE TFrozenMapView<KeyType, ValueType, SortPredicate> GetView() const
+	{
+		return TFrozenMapView<KeyType, ValueType, SortPredicate>(Keys, Values);
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, TFrozenMap& Map)
+	{
+		Ar << Map.Keys;
+		Ar << Map.Values;
+		if (Ar.IsLoading() && Map.Keys.Num() != Map.Values.Num())
+		{
+			Ar.SetError();
+			Map.Keys.Empty();
+			Map.Values.Empty();
+		}
+		return Ar;
+	}
+
+private:
+	void Build(TArray<ElementType>&& Pairs)
+	{
+		SortPredicate Predicate;
+		Algo::StableSort(Pairs, [&Predicate](const ElementType& A, const ElementType& B) { return Predicate(A.Key, B.Key); });
+
+		// Remove duplicate keys, keeping the last pair of each
+		int32 NumUnique = 0;
+		for (int32 Index = 0; Index < Pairs.Num(); ++Index)
+		{
+			if (NumUnique > 0 && !Predicate(Pairs[NumUnique - 1].Key, Pairs[Index].Key))
+			{
+				Pairs[NumUnique - 1] = MoveTemp(Pairs[Index]);
+			}
+			else
+			{
+				if (NumUnique != Index)
+				{
+					Pairs[NumUnique] = MoveTemp(Pairs[Index]);
+				}
+				++NumUnique;
+			}
+		}
+		Pairs.SetNum(NumUnique, false);
+
+		Keys.Empty(NumUnique);
+		Values.Empty(NumUnique);
+		Keys.AddUninitialized(NumUnique);
+		Values.AddUninitialized(NumUnique);
+		FrozenMap_Private::Layout(Pairs, Keys.GetData(), Values.GetData(), 0, 0);
+	}
+
+	TArray<KeyType> Keys;
+	TArray<ValueType> Values;
+};
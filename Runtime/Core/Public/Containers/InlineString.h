@@ -0,0 +1,185 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+#include "Serialization/Archive.h"
+
+/**
+ * A mutable string storing up to NumInlineChars characters (excluding the terminator) inside the object itself,
+ * only allocating once it grows past that. Use it in place of FString for the short names, keys and paths that are
+ * created and destroyed at a high rate.
+ *
+ * Is a contiguous range of TCHAR, so it converts implicitly to FStringView and can be passed to functions taking
+ * views and appended to string builders.
+ * Comparisons and hashing are case insensitive and match FString.
+ */
+template <int32 NumInlineChars = 31>
+class TInlineString
+{
+	static_assert(NumInlineChars > 0, "TInlineString needs room for at least one character");
+
+public:
+	using ElementType = TCHAR;
+
+	TInlineString() = default;
+
+	TInlineString(const TCHAR* Str)
+	{
+		Append(FStringView(Str));
+	}
+
+	explicit TInlineString(FStringView View)
+	{
+		Append(View);
+	}
+
+	explicit TInlineString(const FString& Str)
+	{
+		Append(FStringView(Str));
+	}
+
+	TInlineString& operator=(FStringView View)
+	{
+		Reset();
+		Append(View);
+		return *this;
+	}
+
+	/** Returns a pointer to the null-terminated characters */
+	FORCEINLINE const TCHAR* operator*() const
+	{
+		return Data.Num() ? Data.GetData() : TEXT("");
+	}
+
+	FORCEINLINE int32 Len() const
+	{
+		return Data.Num() ? Data.Num() - 1 : 0;
+	}
+
+	FORCEINLINE bool IsEmpty() const
+	{
+		return Data.Num() <= 1;
+	}
+
+	/** Returns true if the characters currently fit in the inline storage */
+	FORCEINLINE bool IsInline() const
+	{
+		return Data.Max() <= NumInlineChars + 1;
+	}
+
+	FORCEINLINE FStringView ToView() const
+	{
+		return FStringView(**this, Len());
+	}
+
+	FORCEINLINE FString ToString() const
+	{
+		return FString(Len(), **this);
+	}
+
+	TInlineString& Append(FStringView View)
+	{
+		if (const int32 ViewLen = View.Len())
+		{
+			if (View.GetData() >= Data.GetData() && View.GetData() < Data.GetData() + Data.Num())
+			{
+				// Appending part of this string, growing could free the characters before they are copied
+				const FString Copy(View);
+				return Append(FStringView(Copy));
+			}
+
+			const int32 OldLen = Len();
+			Data.SetNumUninitialized(OldLen + ViewLen + 1, false);
+			FMemory::Memcpy(Data.GetData() + OldLen, View.GetData(), ViewLen * sizeof(TCHAR));
+			Data[OldLen + ViewLen] = TEXT('\0');
+		}
+		return *this;
+	}
+
+	TInlineString& AppendChar(TCHAR Char)
+	{
+		return Append(FStringView(&Char, 1));
+	}
+
+	FORCEINLINE TInlineString& operator+=(FStringView View)
+	{
+		return Append(View);
+	}
+
+	FORCEINLINE TInlineString& operator+=(TCHAR Char)
+	{
+		return AppendChar(Char);
+	}
+
+	/** Removes all characters, keeping the allocation if the string grew past the inline storage */
+	FORCEINLINE void Reset()
+	{
+		Data.Reset();
+	}
+
+	/** Removes all characters and returns to the inline storage */
+	FORCEINLINE void Empty()
+	{
+		Data.Empty();
+	}
+
+	FORCEINLINE bool Equals(FStringView Other, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase) const
+	{
+		return ToView().Equals(Other, SearchCase);
+	}
+
+	FORCEINLINE friend bool operator==(const TInlineString& Lhs, const TInlineString& Rhs)
+	{
+		return Lhs.ToView().Equals(Rhs.ToView(), ESearchCase::IgnoreCase);
+	}
+
+	FORCEINLINE friend bool operator!=(const TInlineString& Lhs, const TInlineString& Rhs)
+	{
+		return !(Lhs == Rhs);
+	}
+
+	FORCEINLINE friend uint32 GetTypeHash(const TInlineString& Str)
+	{
+		return GetTypeHash(Str.ToView());
+	}
+
+	FORCEINLINE friend const TCHAR* GetData(const TInlineString& Str)
+	{
+		return *Str;
+	}
+
+	FORCEINLINE friend int32 GetNum(const TInlineString& Str)
+	{
+		return Str.Len();
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, TInlineString& Str)
+	{
+		if (Ar.IsLoading())
+		{
+			FString Loaded;
+			Ar << Loaded;
+			Str = FStringView(Loaded);
+		}
+		else
+		{
+			FString Saved = Str.ToString();
+			Ar << Saved;
+		}
+		return Ar;
+	}
+
+private:
+	/** The characters including the terminator, or nothing for the empty string */
+	TArray<TCHAR, TInlineAllocator<NumInlineChars + 1>> Data;
+};
+
+template <int32 NumInlineChars> struct TIsContiguousContainer<TInlineString<NumInlineChars>> { static constexpr bool Value = true; };
+
+/** An inline string sized for typical names and keys */
+using FInlineString = TInlineString<>;
@@ -0,0 +1,348 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Array.h"
+#include "HAL/PlatformMath.h"
+#include "HAL/UnrealMemory.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/AssertionMacros.h"
+#include "Templates/Atomic.h"
+#include "Templates/MemoryOps.h"
+#include "Templates/UnrealTemplate.h"
+
+namespace UE4SegmentedArray_Private
+{
+	template <typename ArrayType, typename ElementType>
+	struct TSegmentedArrayIterator
+	{
+		TSegmentedArrayIterator(ArrayType& InArray, int32 InIndex)
+			: Array(InArray)
+			, Index(InIndex)
+			, Elem(nullptr)
+			, SegmentEnd(nullptr)
+		{
+			if (Index < Array.Num())
+			{
+				FindSegment();
+			}
+		}
+
+		ArrayType&   Array;
+		int32        Index;
+		ElementType* Elem;
+		ElementType* SegmentEnd;
+
+		ElementType& operator*() const
+		{
+			return *Elem;
+		}
+
+		void operator++()
+		{
+			++Elem;
+			++Index;
+			if (Elem == SegmentEnd && Index < Array.Num())
+			{
+				FindSegment();
+			}
+		}
+
+		/** Only called when crossing into a segment, the rest of the walk is a pointer increment */
+		void FindSegment()
+		{
+			int32 Offset;
+			const int32 SegmentIndex = ArrayType::GetSegmentIndex(Index, Offset);
+			ElementType* Segment = Array.GetSegment(SegmentIndex);
+			Elem = Segment + Offset;
+			SegmentEnd = Segment + ArrayType::GetSegmentSize(SegmentIndex);
+		}
+
+		friend bool operator!=(const TSegmentedArrayIterator& Lhs, const TSegmentedArrayIterator& Rhs)
+		{
+			return Lhs.Index != Rhs.Index;
+		}
+	};
+}
+
+/**
+ * An array of segments that grow geometrically, where elements never move once they have been added and any number of
+ * threads can Emplace at the same time without locks.
+ *
+ * Segment N holds FirstSegmentSize << N elements, so an index maps to its segment with a single FloorLog2 and there are
+ * at most 32 segments. The last segment is cut short so that the segments add up to MAX_int32 elements. Adding an element reserves its index with an atomic increment and only the thread that first
+ * reaches a new segment allocates it, so contention is limited to a counter and a rare compare-exchange.
+ *
+ * Reading, iterating and Num only see elements whose Emplace has been synchronized with the reading thread, for example
+ * by waiting for the ParallelFor or the tasks that added them. Reading an element while other threads keep adding is
+ * fine as long as that element itself was synchronized; its address is stable for the lifetime of the array.
+ */
+template <typename InElementType, uint32 FirstSegmentSize = 16>
+class TSegmentedArray
+{
+	template <typename, typename>
+	friend struct UE4SegmentedArray_Private::TSegmentedArrayIterator;
+
+	static_assert(FirstSegmentSize > 0 && (FirstSegmentSize & (FirstSegmentSize - 1)) == 0, "FirstSegmentSize must be a power of two");
+
+public:
+	using ElementType = InElementType;
+
+	TSegmentedArray()
+		: NumReserved(0)
+	{
+		for (TAtomic<ElementType*>& Segment : Segments)
+		{
+			Segment.Store(nullptr, EMemoryOrder::Relaxed);
+		}
+	}
+
+	~TSegmentedArray()
+	{
+		Empty();
+	}
+
+	// Non-copyable and non-movable, since other threads may hold references to the elements
+	TSegmentedArray(const TSegmentedArray&) = delete;
+	TSegmentedArray& operator=(const TSegmentedArray&) = delete;
+
+	/**
+	 * Constructs an element at the end of the array. Thread safe with other calls to Emplace and EmplaceGetRef.
+	 *
+	 * @return The index of the new element.
+	 */
+	template <typename... ArgsType>
+	int32 Emplace(ArgsType&&... Args)
+	{
+		const int32 Index = NumReserved.IncrementExchange();
+		checkf(Index >= 0 && Index < MAX_int32, TEXT("TSegmentedArray exceeded MAX_int32 elements"));
+
+		int32 Offset;
+		const int32 SegmentIndex = GetSegmentIndex(Index, Offset);
+		new (GetOrAllocateSegment(SegmentIndex) + Offset) ElementType(Forward<ArgsType>(Args)...);
+		return Index;
+	}
+
+	/**
+	 * Constructs an element at the end of the array. Thread safe with other calls to Emplace and EmplaceGetRef.
+	 *
+	 * @return A reference to the new element, which stays valid until the array is emptied.
+	 */
+	template <typename... ArgsType>
+	ElementType& EmplaceGetRef(ArgsType&&... Args)
+	{
+		const int32 Index = NumReserved.IncrementExchange();
+		checkf(Index >= 0 && Index < MAX_int32, TEXT("TSegmentedArray exceeded MAX_int32 elements"));
+
+		int32 Offset;
+		const int32 SegmentIndex = GetSegmentIndex(Index, Offset);
+		return *new (GetOrAllocateSegment(SegmentIndex) + Offset) ElementType(Forward<ArgsType>(Args)...);
+	}
+
+	FORCEINLINE int32 Add(const ElementType& Item)
+	{
+		return Emplace(Item);
+	}
+
+	FORCEINLINE int32 Add(ElementType&& Item)
+	{
+		return Emplace(MoveTemp(Item));
+	}
+
+	/** The number of elements added, see the class comment for when it includes the elements added by other threads. */
+	FORCEINLINE int32 Num() const
+	{
+		return NumReserved.Load(EMemoryOrder::Relaxed);
+	}
+
+	FORCEINLINE bool IsValidIndex(int32 Index) const
+	{
+		return Index >= 0 && Index < Num();
+	}
+
+	FORCEINLINE ElementType& operator[](int32 Index)
+	{
+		checkSlow(IsValidIndex(Index));
+		int32 Offset;
+		const int32 SegmentIndex = GetSegmentIndex(Index, Offset);
+		return GetSegment(SegmentIndex)[Offset];
+	}
+
+	FORCEINLINE const ElementType& operator[](int32 Index) const
+	{
+		return const_cast<TSegmentedArray*>(this)->operator[](Index);
+	}
+
+	/** Destroys all elements and frees the segments. Not thread safe. */
+	void Empty()
+	{
+		int32 NumRemaining = Num();
+		for (int32 SegmentIndex = 0; SegmentIndex < MaxSegments; ++SegmentIndex)
+		{
+			ElementType* Segment = Segments[SegmentIndex].Load(EMemoryOrder::Relaxed);
+			if (!Segment)
+			{
+				break;
+			}
+
+			const int32 NumInSegment = FMath::Min<int32>(NumRemaining, GetSegmentSize(SegmentIndex));
+			DestructItems(Segment, NumInSegment);
+			NumRemaining -= NumInSegment;
+
+			FMemory::Free(Segment);
+			Segments[SegmentIndex].Store(nullptr, EMemoryOrder::Relaxed);
+		}
+		NumReserved.Store(0, EMemoryOrder::Relaxed);
+	}
+
+	/** Calls Func on each element in order. */
+	template <typename FuncType>
+	void ForEach(FuncType&& Func)
+	{
+		int32 NumRemaining = Num();
+		for (int32 SegmentIndex = 0; NumRemaining > 0; ++SegmentIndex)
+		{
+			const int32 NumInSegment = FMath::Min<int32>(NumRemaining, GetSegmentSize(SegmentIndex));
+			ElementType* Segment = GetSegment(SegmentIndex);
+			for (ElementType* Elem = Segment; Elem != Segment + NumInSegment; ++Elem)
+			{
+				Func(*Elem);
+			}
+			NumRemaining -= NumInSegment;
+		}
+	}
+
+	template <typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		const_cast<TSegmentedArray*>(this)->ForEach([&Func](ElementType& Elem) { Func(const_cast<const ElementType&>(Elem)); });
+	}
+
+	/**
+	 * Calls Func on each element from task threads, splitting the segments into blocks so that the large segments don't
+	 * end up on a single thread. Func must be safe to call concurrently on different elements.
+	 *
+	 * @param Func       Called with each element.
+	 * @param BlockSize  The maximum number of elements visited by one call of the ParallelFor body.
+	 */
+	template <typename FuncType>
+	void ParallelForEach(FuncType&& Func, int32 BlockSize = 1024)
+	{
+		check(BlockSize > 0);
+
+		struct FBlock
+		{
+			ElementType* Elements;
+			int32 Num;
+		};
+
+		TArray<FBlock, TInlineAllocator<64>> Blocks;
+		int32 NumRemaining = Num();
+		for (int32 SegmentIndex = 0; NumRemaining > 0; ++SegmentIndex)
+		{
+			const int32 NumInSegment = FMath::Min<int32>(NumRemaining, GetSegmentSize(SegmentIndex));
+			ElementType* Segment = GetSegment(SegmentIndex);
+			for (int32 Start = 0; Start < NumInSegment; Start += BlockSize)
+			{
+				Blocks.Add({ Segment + Start, FMath::Min(BlockSize, NumInSegment - Start) });
+			}
+			NumRemaining -= NumInSegment;
+		}
+
+		ParallelFor(Blocks.Num(), [&Blocks, &Func](int32 BlockIndex)
+		{
+			const FBlock& Block = Blocks[BlockIndex];
+			for (ElementType* Elem = Block.Elements; Elem != Block.Elements + Block.Num; ++Elem)
+			{
+				Func(*Elem);
+			}
+		});
+	}
+
+	template <typename FuncType>
+	void ParallelForEach(FuncType&& Func, int32 BlockSize = 1024) const
+	{
+		const_cast<TSegmentedArray*>(this)->ParallelForEach([&Func](ElementType& Elem) { Func(const_cast<const ElementType&>(Elem)); }, BlockSize);
+	}
+
+	/** Copies the elements to a contiguous array. */
+	TArray<ElementType> ToArray() const
+	{
+		TArray<ElementType> Result;
+		Result.Reserve(Num());
+		ForEach([&Result](const ElementType& Elem) { Result.Add(Elem); });
+		return Result;
+	}
+
+	SIZE_T GetAllocatedSize() const
+	{
+		SIZE_T Size = 0;
+		for (int32 SegmentIndex = 0; SegmentIndex < MaxSegments && Segments[SegmentIndex].Load(EMemoryOrder::Relaxed); ++SegmentIndex)
+		{
+			Size += GetSegmentSize(SegmentIndex) * sizeof(ElementType);
+		}
+		return Size;
+	}
+
+private:
+	typedef UE4SegmentedArray_Private::TSegmentedArrayIterator<      TSegmentedArray,       ElementType> FIterType;
+	typedef UE4SegmentedArray_Private::TSegmentedArrayIterator<const TSegmentedArray, const ElementType> FConstIterType;
+
+public:
+	/**
+	 * DO NOT USE DIRECTLY
+	 * STL-like iterators to enable range-based for loop support.
+	 */
+	FORCEINLINE FIterType      begin()       { return FIterType(*this, 0); }
+	FORCEINLINE FConstIterType begin() const { return FConstIterType(*this, 0); }
+	FORCEINLINE FIterType      end()         { return FIterType(*this, Num()); }
+	FORCEINLINE FConstIterType end()   const { return FConstIterType(*this, Num()); }
+
+private:
+	static constexpr int32 MaxSegments = 32;
+
+	/** FirstSegmentSize << SegmentIndex, except for the last segment which only holds the indices below MAX_int32 */
+	FORCEINLINE static int32 GetSegmentSize(int32 SegmentIndex)
+	{
+		const uint64 SegmentStart = FMath::Min<uint64>(uint64(FirstSegmentSize) * ((uint64(1) << SegmentIndex) - 1), MAX_int32);
+		return int32(FMath::Min<uint64>(uint64(FirstSegmentSize) << SegmentIndex, uint64(MAX_int32) - SegmentStart));
+	}
+
+	/** Segment N starts at index FirstSegmentSize * (2^N - 1), so N is the log of the index in units of the first segment */
+	FORCEINLINE static int32 GetSegmentIndex(int32 Index, int32& OutOffset)
+	{
+		const uint32 SegmentIndex = FPlatformMath::FloorLog2(uint32(Index) / FirstSegmentSize + 1);
+		OutOffset = int32(uint64(Index) - uint64(FirstSegmentSize) * ((uint64(1) << SegmentIndex) - 1));
+		return int32(SegmentIndex);
+	}
+
+	FORCEINLINE ElementType* GetSegment(int32 SegmentIndex) const
+	{
+		ElementType* Segment = Segments[SegmentIndex].Load(EMemoryOrder::Relaxed);
+		checkSlow(Segment);
+		return Segment;
+	}
+
+	ElementType* GetOrAllocateSegment(int32 SegmentIndex)
+	{
+		ElementType* Segment = Segments[SegmentIndex].Load();
+		if (Segment)
+		{
+			return Segment;
+		}
+
+		// Several threads can race to allocate a segment, the first to install it wins and the others free theirs
+		ElementType* NewSegment = (ElementType*)FMemory::Malloc(SIZE_T(GetSegmentSize(SegmentIndex)) * sizeof(ElementType), alignof(ElementType));
+		if (Segments[SegmentIndex].CompareExchange(Segment, NewSegment))
+		{
+			return NewSegment;
+		}
+		FMemory::Free(NewSegment);
+		return Segment;
+	}
+
+	TAtomic<int32> NumReserved;
+	TAtomic<ElementType*> Segments[MaxSegments];
+};
@@ -0,0 +1,198 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "HAL/PlatformAtomics.h"
+#include "HAL/UnrealMemory.h"
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+#include "Serialization/Archive.h"
+
+/**
+ * An immutable, reference counted string. Copies share the characters, so it suits strings that are built once and
+ * then copied around and stored in many places, like asset paths and config values.
+ *
+ * The characters and the reference count live in a single allocation, and the empty string doesn't allocate.
+ * Is a contiguous range of TCHAR, so it converts implicitly to FStringView and can be passed to functions taking
+ * views and appended to string builders. Comparisons and hashing are case insensitive and match FString.
+ */
+class FSharedString
+{
+public:
+	FSharedString() = default;
+
+	FSharedString(const TCHAR* Str)
+		: FSharedString(FStringView(Str))
+	{
+	}
+
+	explicit FSharedString(const FString& Str)
+		: FSharedString(FStringView(Str))
+	{
+	}
+
+	explicit FSharedString(FStringView View)
+	{
+		if (const int32 ViewLen = View.Len())
+		{
+			Data = (FData*)FMemory::Malloc(sizeof(FData) + (ViewLen + 1) * sizeof(TCHAR), alignof(FData));
+			Data->NumRefs = 1;
+			Data->Len = ViewLen;
+			TCHAR* Chars = Data->GetChars();
+			FMemory::Memcpy(Chars, View.GetData(), ViewLen * sizeof(TCHAR));
+			Chars[ViewLen] = TEXT('\0');
+		}
+	}
+
+	FSharedString(const FSharedString& Other)
+		: Data(Other.Data)
+	{
+		AddRef();
+	}
+
+	FSharedString(FSharedString&& Other)
+		: Data(Other.Data)
+	{
+		Other.Data = nullptr;
+	}
+
+	~FSharedString()
+	{
+		Release();
+	}
+
+	FSharedString& operator=(const FSharedString& Other)
+	{
+		if (Data != Other.Data)
+		{
+			Release();
+			Data = Other.Data;
+			AddRef();
+		}
+		return *this;
+	}
+
+	FSharedString& operator=(FSharedString&& Other)
+	{
+		if (this != &Other)
+		{
+			Release();
+			Data = Other.Data;
+			Other.Data = nullptr;
+		}
+		return *this;
+	}
+
+	/** Returns a pointer to the null-terminated characters */
+	FORCEINLINE const TCHAR* operator*() const
+	{
+		return Data ? Data->GetChars() : TEXT("");
+	}
+
+	FORCEINLINE int32 Len() const
+	{
+		return Data ? Data->Len : 0;
+	}
+
+	FORCEINLINE bool IsEmpty() const
+	{
+		return Data == nullptr;
+	}
+
+	FORCEINLINE FStringView ToView() const
+	{
+		return FStringView(**this, Len());
+	}
+
+	FORCEINLINE FString ToString() const
+	{
+		return FString(Len(), **this);
+	}
+
+	/** Returns true if both strings share the same characters, a cheaper test than comparing them */
+	FORCEINLINE bool IsSameData(const FSharedString& Other) const
+	{
+		return Data == Other.Data;
+	}
+
+	FORCEINLINE bool Equals(FStringView Other, ESearchCase::Type SearchCase = ESearchCase::IgnoreCase) const
+	{
+		return ToView().Equals(Other, SearchCase);
+	}
+
+	FORCEINLINE friend bool operator==(const FSharedString& Lhs, const FSharedString& Rhs)
+	{
+		return Lhs.Data == Rhs.Data || Lhs.ToView().Equals(Rhs.ToView(), ESearchCase::IgnoreCase);
+	}
+
+	FORCEINLINE friend bool operator!=(const FSharedString& Lhs, const FSharedString& Rhs)
+	{
+		return !(Lhs == Rhs);
+	}
+
+	FORCEINLINE friend uint32 GetTypeHash(const FSharedString& Str)
+	{
+		return GetTypeHash(Str.ToView());
+	}
+
+	FORCEINLINE friend const TCHAR* GetData(const FSharedString& Str)
+	{
+		return *Str;
+	}
+
+	FORCEINLINE friend int32 GetNum(const FSharedString& Str)
+	{
+		return Str.Len();
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FSharedString& Str)
+	{
+		if (Ar.IsLoading())
+		{
+			FString Loaded;
+			Ar << Loaded;
+			Str = FSharedString(FStringView(Loaded));
+		}
+		else
+		{
+			FString Saved = Str.ToString();
+			Ar << Saved;
+		}
+		return Ar;
+	}
+
+private:
+	/** Header of the allocation, followed by the null-terminated characters */
+	struct FData
+	{
+		int32 NumRefs;
+		int32 Len;
+
+		FORCEINLINE TCHAR* GetChars()
+		{
+			return reinterpret_cast<TCHAR*>(this + 1);
+		}
+	};
+
+	FORCEINLINE void AddRef()
+	{
+		if (Data)
+		{
+			FPlatformAtomics::InterlockedIncrement(&Data->NumRefs);
+		}
+	}
+
+	FORCEINLINE void Release()
+	{
+		if (Data && FPlatformAtomics::InterlockedDecrement(&Data->NumRefs) == 0)
+		{
+			FMemory::Free(Data);
+		}
+		Data = nullptr;
+	}
+
+	FData* Data = nullptr;
+};
+
+template <> struct TIsContiguousContainer<FSharedString> { static constexpr bool Value = true; };
@@ -10,6 +10,7 @@
 #include "Containers/ContainerAllocationPolicies.h"
 #include "Containers/Array.h"
 #include "Misc/CString.h"
+#include "GenericPlatform/GenericPlatformStringSimd.h"
 
 #define DEFAULT_STRING_CONVERSION_SIZE 128u
 #define UNICODE_BOGUS_CHAR_CODEPOINT '?'
@@ -298,6 +299,14 @@ private:
 #if PLATFORM_TCHAR_IS_4_BYTES
 		for (int32 i = 0; i < SourceLen; ++i)
 		{
+			const int32 NumAscii = CopyAsciiRun(Dest, DestLen, Source + i, SourceLen - i);
+			i += NumAscii;
+			DestLen -= NumAscii;
+			if (i == SourceLen)
+			{
+				break;
+			}
+
 			uint32 Codepoint = static_cast<uint32>(Source[i]);
 
 			if (!WriteCodepointToBuffer(Codepoint, Dest, DestLen))
@@ -311,6 +320,17 @@ private:
 
 		for (int32 i = 0; i < SourceLen; ++i)
 		{
+			if (HighSurrogate == MAX_uint32)
+			{
+				const int32 NumAscii = CopyAsciiRun(Dest, DestLen, Source + i, SourceLen - i);
+				i += NumAscii;
+				DestLen -= NumAscii;
+				if (i == SourceLen)
+				{
+					break;
+				}
+			}
+
 			const bool bHighSurrogateIsSet = HighSurrogate != MAX_uint32;
 			uint32 Codepoint = static_cast<uint32>(Source[i]);
 
@@ -367,6 +387,33 @@ private:
 		return UE_PTRDIFF_TO_INT32(Dest - DestStartingPosition);
 	}
 
+	/** Copies the run of ASCII characters at the start of Source, up to DestLen, and returns its length */
+	static FORCEINLINE int32 CopyAsciiRun(ANSICHAR*& Dest, int32 DestLen, const TCHAR* Source, int32 SourceLen)
+	{
+		const int32 NumAscii = FGenericPlatformStringSimd::CountAscii(Source, SourceLen < DestLen ? SourceLen : DestLen);
+		FGenericPlatformStringSimd::NarrowAscii(Dest, Source, NumAscii);
+		Dest += NumAscii;
+		return NumAscii;
+	}
+
+	static FORCEINLINE int32 CopyAsciiRun(UE4StringConv_Private::FCountingOutputIterator& Dest, int32 DestLen, const TCHAR* Source, int32 SourceLen)
+	{
+		const int32 NumAscii = FGenericPlatformStringSimd::CountAscii(Source, SourceLen < DestLen ? SourceLen : DestLen);
+		Dest += NumAscii;
+		return NumAscii;
+	}
+
+	template <typename DestBufferType>
+	static FORCEINLINE int32 CopyAsciiRun(DestBufferType& Dest, int32 DestLen, const TCHAR* Source, int32 SourceLen)
+	{
+		const int32 NumAscii = FGenericPlatformStringSimd::CountAscii(Source, SourceLen < DestLen ? SourceLen : DestLen);
+		for (int32 Index = 0; Index < NumAscii; ++Index)
+		{
+			*(Dest++) = (ANSICHAR)Source[Index];
+		}
+		return NumAscii;
+	}
+
 	template <typename DestBufferType>
 	static bool WriteCodepointToBuffer(const uint32 Codepoint, DestBufferType& Dest, int32& DestLen)
 	{
@@ -651,34 +698,12 @@ private:
 	{
 		const ANSICHAR* SourceEnd = Source + SourceLen;
 
-		const uint64 ExtendedCharMask = 0x8080808080808080;
 		while (Source < SourceEnd && DestLen > 0)
 		{
-			// In case we're given an unaligned pointer, we'll
-			// fallback to the slow path until properly aligned.
-			if (IsAligned(Source, 8))
-			{
-				// Fast path for most common case
-				while (Source < SourceEnd - 8 && DestLen >= 8)
-				{
-					// Detect any extended characters 8 chars at a time
-					if ((*(const uint64*)Source) & ExtendedCharMask)
-					{
-						// Move to slow path since we got extended characters to process
-						break;
-					}
-
-					// This should get unrolled on most compiler
-					// ROI of diminished return to vectorize this as we 
-					// would have to deal with alignment, endianness and
-					// rewrite the iterators to support bulk writes
-					for (int32 Index = 0; Index < 8; ++Index)
-					{
-						*(ConvertedBuffer++) = (ToType)(uint8)*(Source++);
-					}
-					DestLen -= 8;
-				}
-			}
+			// Fast path for runs of ASCII characters, the most common case
+			const int32 NumAscii = CopyAsciiRun(ConvertedBuffer, DestLen, Source, UE_PTRDIFF_TO_INT32(SourceEnd - Source));
+			Source += NumAscii;
+			DestLen -= NumAscii;
 
 			// Slow path for extended characters
 			while (Source < SourceEnd && DestLen > 0)
@@ -716,16 +741,132 @@ private:
 				*(ConvertedBuffer++) = (ToType)Codepoint;
 				--DestLen;
 
-				// Return to the fast path once aligned and back to simple ASCII chars
-				if (Codepoint < 128 && IsAligned(Source, 8))
+				// Return to the fast path once back to simple ASCII chars
+				if (Codepoint < 128)
 				{
 					break;
 				}
 			}
 		}
 	}
+
+	/** Copies the run of ASCII characters at the start of Source, up to DestLen, and returns its length */
+	static FORCEINLINE int32 CopyAsciiRun(TCHAR*& Dest, int32 DestLen, const ANSICHAR* Source, int32 SourceLen)
+	{
+		const int32 NumAscii = FGenericPlatformStringSimd::CountAscii(Source, SourceLen < DestLen ? SourceLen : DestLen);
+		FGenericPlatformStringSimd::WidenAscii(Dest, Source, NumAscii);
+		Dest += NumAscii;
+		return NumAscii;
+	}
+
+	static FORCEINLINE int32 CopyAsciiRun(UE4StringConv_Private::FCountingOutputIterator& Dest, int32 DestLen, const ANSICHAR* Source, int32 SourceLen)
+	{
+		const int32 NumAscii = FGenericPlatformStringSimd::CountAscii(Source, SourceLen < DestLen ? SourceLen : DestLen);
+		Dest += NumAscii;
+		return NumAscii;
+	}
+
+	template <typename DestBufferType>
+	static FORCEINLINE int32 CopyAsciiRun(DestBufferType& Dest, int32 DestLen, const ANSICHAR* Source, int32 SourceLen)
+	{
+		const int32 NumAscii = FGenericPlatformStringSimd::CountAscii(Source, SourceLen < DestLen ? SourceLen : DestLen);
+		for (int32 Index = 0; Index < NumAscii; ++Index)
+		{
+			*(Dest++) = (ToType)(uint8)Source[Index];
+		}
+		return NumAscii;
+	}
 };
 
+namespace StringConv
+{
+	/**
+	 * Checks that Source is well-formed UTF-8: no stray continuation bytes, truncated or overlong sequences,
+	 * encoded surrogates or codepoints above 10FFFFh. Runs of ASCII characters are skipped 16 bytes at a time.
+	 */
+	inline bool IsValidUtf8(const ANSICHAR* Source, int32 SourceLen)
+	{
+		const uint8* Bytes = reinterpret_cast<const uint8*>(Source);
+		const uint8* BytesEnd = Bytes + SourceLen;
+		while (true)
+		{
+			Bytes += FGenericPlatformStringSimd::CountAscii(reinterpret_cast<const ANSICHAR*>(Bytes), UE_PTRDIFF_TO_INT32(BytesEnd - Bytes));
+			if (Bytes == BytesEnd)
+			{
+				return true;
+			}
+
+			// The valid range of the second byte depends on the lead byte, the other continuation bytes are always 80h-BFh
+			const uint8 Lead = *Bytes;
+			int32 NumContinuations;
+			uint8 SecondMin = 0x80;
+			uint8 SecondMax = 0xBF;
+			if (Lead < 0xC2)
+			{
+				// Continuation byte or overlong two byte sequence
+				return false;
+			}
+			else if (Lead < 0xE0)
+			{
+				NumContinuations = 1;
+			}
+			else if (Lead < 0xF0)
+			{
+				NumContinuations = 2;
+				SecondMin = Lead == 0xE0 ? 0xA0 : 0x80; // Overlong
+				SecondMax = Lead == 0xED ? 0x9F : 0xBF; // Surrogates
+			}
+			else if (Lead < 0xF5)
+			{
+				NumContinuations = 3;
+				SecondMin = Lead == 0xF0 ? 0x90 : 0x80; // Overlong
+				SecondMax = Lead == 0xF4 ? 0x8F : 0xBF; // Above 10FFFFh
+			}
+			else
+			{
+				return false;
+			}
+
+			if (BytesEnd - Bytes <= NumContinuations || Bytes[1] < SecondMin || Bytes[1] > SecondMax)
+			{
+				return false;
+			}
+			for (int32 Index = 2; Index <= NumContinuations; ++Index)
+			{
+				if ((Bytes[Index] & 0xC0) != 0x80)
+				{
+					return false;
+				}
+			}
+			Bytes += NumContinuations + 1;
+		}
+	}
+
+	/**
+	 * Appends UTF-8 text converted to TCHAR to a TStringBuilder without any temporary allocation.
+	 * Invalid sequences are replaced like FUTF8ToTCHAR does.
+	 */
+	template <typename BuilderType>
+	inline void AppendUtf8(BuilderType& Builder, const ANSICHAR* Source, int32 SourceLen)
+	{
+		const int32 ConvertedLen = FUTF8ToTCHAR_Convert::ConvertedLength(Source, SourceLen);
+		const int32 Offset = Builder.AddUninitialized(ConvertedLen);
+		FUTF8ToTCHAR_Convert::Convert(Builder.GetData() + Offset, ConvertedLen, Source, SourceLen);
+	}
+
+	/** Appends TCHAR text converted to UTF-8 to an ANSICHAR TStringBuilder without any temporary allocation */
+	template <typename BuilderType>
+	inline void AppendTCHARToUtf8(BuilderType& Builder, const TCHAR* Source, int32 SourceLen)
+	{
+		// Each TCHAR encodes to at most 3 bytes, or 4 bytes for UTF-32, reserve that and give back what isn't used
+		const int32 MaxConvertedLen = SourceLen * (PLATFORM_TCHAR_IS_4_BYTES ? 4 : 3);
+		const int32 Offset = Builder.AddUninitialized(MaxConvertedLen);
+		const int32 ConvertedLen = FTCHARToUTF8_Convert::Convert(Builder.GetData() + Offset, MaxConvertedLen, Source, SourceLen);
+		check(ConvertedLen >= 0);
+		Builder.RemoveSuffix(MaxConvertedLen - ConvertedLen);
+	}
+}
+
 template<typename InFromType, typename InToType>
 class TUTF32ToUTF16_Convert
 {
@@ -0,0 +1,819 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+// Open addressing hash set and map in the style of Abseil's Swiss tables.
+// Elements are stored inline in a single slot array, a parallel array of control bytes holds 7 bits of each element's
+// hash and is probed a group of 16 slots at a time, so most lookups touch one control group and one slot.
+#include "CoreMinimal.h"
+#include "Containers/Map.h"
+#include "Templates/MemoryOps.h"
+#include "Templates/TypeCompatibleBytes.h"
+#include "Templates/UnrealTemplate.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+#include <emmintrin.h>
+#define UE_SWISS_HASH_TABLE_SSE2 1
+#else
+#define UE_SWISS_HASH_TABLE_SSE2 0
+#endif
+
+namespace Experimental
+{
+
+namespace SwissHashTable_Private
+{
+	/** Control byte values of slots without an element, full slots store the 7 bit hash fragment and have the sign bit clear */
+	static constexpr int8 ControlEmpty = -128;
+	static constexpr int8 ControlDeleted = -2;
+
+	/** Number of slots probed at once */
+	static constexpr int32 GroupWidth = 16;
+
+	/** One bit per slot of a group */
+	struct FGroupMask
+	{
+		uint32 Mask;
+
+		FORCEINLINE explicit operator bool() const
+		{
+			return Mask != 0;
+		}
+
+		FORCEINLINE int32 LowestSlot() const
+		{
+			return (int32)FMath::CountTrailingZeros(Mask);
+		}
+
+		FORCEINLINE void ClearLowestSlot()
+		{
+			Mask &= Mask - 1;
+		}
+	};
+
+	/** The control bytes of one group of slots */
+	struct FGroup
+	{
+#if UE_SWISS_HASH_TABLE_SSE2
+		__m128i Control;
+
+		FORCEINLINE explicit FGroup(const int8* GroupControl)
+			: Control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(GroupControl)))
+		{
+		}
+
+		FORCEINLINE FGroupMask Match(int8 HashFragment) const
+		{
+			return FGroupMask{ (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(Control, _mm_set1_epi8(HashFragment))) };
+		}
+
+		FORCEINLINE FGroupMask MatchEmptyOrDeleted() const
+		{
+			// Only empty and deleted slots have the sign bit set
+			return FGroupMask{ (uint32)_mm_movemask_epi8(Control) };
+		}
+#else
+		const int8* Control;
+
+		FORCEINLINE explicit FGroup(const int8* GroupControl)
+			: Control(GroupControl)
+		{
+		}
+
+		FORCEINLINE FGroupMask Match(int8 HashFragment) const
+		{
+			uint32 Mask = 0;
+			for (int32 Slot = 0; Slot < GroupWidth; ++Slot)
+			{
+				Mask |= uint32(Control[Slot] == HashFragment) << Slot;
+			}
+			return FGroupMask{ Mask };
+		}
+
+		FORCEINLINE FGroupMask MatchEmptyOrDeleted() const
+		{
+			uint32 Mask = 0;
+			for (int32 Slot = 0; Slot < GroupWidth; ++Slot)
+			{
+				Mask |= uint32(Control[Slot] < 0) << Slot;
+			}
+			return FGroupMask{ Mask };
+		}
+#endif
+
+		FORCEINLINE FGroupMask MatchEmpty() const
+		{
+			return Match(ControlEmpty);
+		}
+	};
+
+	/** Spreads the bits of a key hash, many key hashes (e.g. of integers) only vary in their low bits */
+	FORCEINLINE uint64 MixHash(uint32 KeyHash)
+	{
+		return uint64(KeyHash) * 0x9E3779B97F4A7C15ull;
+	}
+
+	FORCEINLINE int8 GetHashFragment(uint64 MixedHash)
+	{
+		return int8(MixedHash >> 57);
+	}
+
+	FORCEINLINE uint32 GetFirstGroup(uint64 MixedHash)
+	{
+		return uint32(MixedHash >> 32);
+	}
+
+	/** Maximum number of elements and deleted slots before growing, 7/8 of the capacity */
+	FORCEINLINE int32 GetMaxLoad(int32 Capacity)
+	{
+		return Capacity - Capacity / 8;
+	}
+}
+
+/**
+ * Open addressing hash set probing groups of control bytes.
+ *
+ * Supports the same KeyFuncs and set allocator policies as TSet, except that duplicate keys are not allowed. Both the control
+ * bytes and the slots use the element allocator of the set allocator's sparse array allocator, e.g. TInlineSetAllocator<N>
+ * keeps up to N slots inline.
+ * Elements don't move while the set isn't resized, and FSetElementIds stay valid until the set is resized or emptied.
+ * Adding elements may resize the set, removing them never does.
+ */
+template<typename InElementType, typename KeyFuncs = DefaultKeyFuncs<InElementType>, typename Allocator = FDefaultSetAllocator>
+class TSwissSet
+{
+	/** There is no sparse array or hash, the slots are allocated with the allocator TSet uses for its elements */
+	using ArrayAllocator = typename Allocator::SparseArrayAllocator::ElementAllocator;
+
+public:
+	using ElementType = InElementType;
+	using KeyInitType = typename KeyFuncs::KeyInitType;
+	using ElementInitType = typename KeyFuncs::ElementInitType;
+
+	static_assert(!KeyFuncs::bAllowDuplicateKeys, "TSwissSet does not support duplicate keys");
+
+	TSwissSet() = default;
+
+	TSwissSet(const TSwissSet& Other)
+	{
+		*this = Other;
+	}
+
+	TSwissSet(TSwissSet&& Other)
+	{
+		*this = MoveTemp(Other);
+	}
+
+	~TSwissSet()
+	{
+		DestructElements();
+	}
+
+	TSwissSet& operator=(const TSwissSet& Other)
+	{
+		if (this != &Other)
+		{
+			Empty(Other.Num());
+			for (const ElementType& Element : Other)
+			{
+				Add(Element);
+			}
+		}
+		return *this;
+	}
+
+	TSwissSet& operator=(TSwissSet&& Other)
+	{
+		if (this != &Other)
+		{
+			DestructElements();
+			Control = MoveTemp(Other.Control);
+			Slots = MoveTemp(Other.Slots);
+			NumElements = Other.NumElements;
+			NumDeleted = Other.NumDeleted;
+			Other.Control.Empty();
+			Other.Slots.Empty();
+			Other.NumElements = 0;
+			Other.NumDeleted = 0;
+		}
+		return *this;
+	}
+
+	/** @return the number of elements */
+	FORCEINLINE int32 Num() const
+	{
+		return NumElements;
+	}
+
+	/** @return the exclusive upper bound of the element ids */
+	FORCEINLINE int32 GetMaxIndex() const
+	{
+		return Control.Num();
+	}
+
+	FORCEINLINE bool IsValidId(FSetElementId Id) const
+	{
+		const int32 Index = Id.AsInteger();
+		return Index >= 0 && Index < Control.Num() && Control[Index] >= 0;
+	}
+
+	FORCEINLINE ElementType& operator[](FSetElementId Id)
+	{
+		checkSlow(IsValidId(Id));
+		return GetElement(Id.AsInteger());
+	}
+
+	FORCEINLINE const ElementType& operator[](FSetElementId Id) const
+	{
+		checkSlow(IsValidId(Id));
+		return GetElement(Id.AsInteger());
+	}
+
+	/** Removes all elements, optionally presizing for ExpectedNumElements */
+	void Empty(int32 ExpectedNumElements = 0)
+	{
+		DestructElements();
+		Control.Empty();
+		Slots.Empty();
+		NumElements = 0;
+		NumDeleted = 0;
+		Reserve(ExpectedNumElements);
+	}
+
+	/** Removes all elements, keeping the allocated memory */
+	void Reset()
+	{
+		DestructElements();
+		FMemory::Memset(Control.GetData(), uint8(SwissHashTable_Private::ControlEmpty), Control.Num());
+		NumElements = 0;
+		NumDeleted = 0;
+	}
+
+	/** Makes room for Number elements without further allocations */
+	void Reserve(int32 Number)
+	{
+		const int32 NewCapacity = GetCapacityFor(Number);
+		if (NewCapacity > Control.Num())
+		{
+			Rehash(NewCapacity);
+		}
+	}
+
+	/** Shrinks the allocation to the smallest capacity holding the current elements and drops deleted slots */
+	void Shrink()
+	{
+		const int32 NewCapacity = NumElements ? GetCapacityFor(NumElements) : 0;
+		if (NewCapacity != Control.Num() || NumDeleted > 0)
+		{
+			Rehash(NewCapacity);
+		}
+	}
+
+	FORCEINLINE FSetElementId Add(const ElementType& InElement, bool* bIsAlreadyInSetPtr = nullptr)
+	{
+		return Emplace(InElement, bIsAlreadyInSetPtr);
+	}
+
+	FORCEINLINE FSetElementId Add(ElementType&& InElement, bool* bIsAlreadyInSetPtr = nullptr)
+	{
+		return Emplace(MoveTempIfPossible(InElement), bIsAlreadyInSetPtr);
+	}
+
+	/**
+	 * Adds an element constructed from Args, replacing an existing element with the same key like TSet does.
+	 *
+	 * @param Args					The argument to construct the element with
+	 * @param bIsAlreadyInSetPtr	[out] Optional pointer to bool that will be set depending on whether the key was already in the set
+	 * @return The id of the element
+	 */
+	template <typename ArgsType>
+	FSetElementId Emplace(ArgsType&& Args, bool* bIsAlreadyInSetPtr = nullptr)
+	{
+		TTypeCompatibleBytes<ElementType> NewElement;
+		new (&NewElement) ElementType(Forward<ArgsType>(Args));
+
+		const uint32 KeyHash = KeyFuncs::GetKeyHash(KeyFuncs::GetSetKey(*NewElement.GetTypedPtr()));
+		int32 Index = FindIndexByHash(KeyHash, KeyFuncs::GetSetKey(*NewElement.GetTypedPtr()));
+		const bool bIsAlreadyInSet = Index != INDEX_NONE;
+		if (bIsAlreadyInSet)
+		{
+			DestructItem(&GetElement(Index));
+		}
+		else
+		{
+			Index = AllocateSlot(KeyHash);
+		}
+		RelocateConstructItems<ElementType>(&Slots[Index], NewElement.GetTypedPtr(), 1);
+
+		if (bIsAlreadyInSetPtr)
+		{
+			*bIsAlreadyInSetPtr = bIsAlreadyInSet;
+		}
+		return FSetElementId::FromInteger(Index);
+	}
+
+	/** Adds an element constructed from Args whose key with hash KeyHash is known not to be in the set */
+	template <typename ArgsType>
+	FSetElementId EmplaceNewByHash(uint32 KeyHash, ArgsType&& Args)
+	{
+		const int32 Index = AllocateSlot(KeyHash);
+		new (&Slots[Index]) ElementType(Forward<ArgsType>(Args));
+		return FSetElementId::FromInteger(Index);
+	}
+
+	FORCEINLINE FSetElementId FindId(KeyInitType Key) const
+	{
+		return FSetElementId::FromInteger(FindIndexByHash(KeyFuncs::GetKeyHash(Key), Key));
+	}
+
+	template <typename ComparableKey>
+	FORCEINLINE FSetElementId FindIdByHash(uint32 KeyHash, const ComparableKey& Key) const
+	{
+		return FSetElementId::FromInteger(FindIndexByHash(KeyHash, Key));
+	}
+
+	FORCEINLINE ElementType* Find(KeyInitType Key)
+	{
+		const int32 Index = FindIndexByHash(KeyFuncs::GetKeyHash(Key), Key);
+		return Index != INDEX_NONE ? &GetElement(Index) : nullptr;
+	}
+
+	FORCEINLINE const ElementType* Find(KeyInitType Key) const
+	{
+		return const_cast<TSwissSet*>(this)->Find(Key);
+	}
+
+	template <typename ComparableKey>
+	FORCEINLINE ElementType* FindByHash(uint32 KeyHash, const ComparableKey& Key)
+	{
+		const int32 Index = FindIndexByHash(KeyHash, Key);
+		return Index != INDEX_NONE ? &GetElement(Index) : nullptr;
+	}
+
+	template <typename ComparableKey>
+	FORCEINLINE const ElementType* FindByHash(uint32 KeyHash, const ComparableKey& Key) const
+	{
+		return const_cast<TSwissSet*>(this)->FindByHash(KeyHash, Key);
+	}
+
+	FORCEINLINE bool Contains(KeyInitType Key) const
+	{
+		return FindIndexByHash(KeyFuncs::GetKeyHash(Key), Key) != INDEX_NONE;
+	}
+
+	/** @return the number of elements removed */
+	int32 Remove(KeyInitType Key)
+	{
+		const int32 Index = FindIndexByHash(KeyFuncs::GetKeyHash(Key), Key);
+		if (Index == INDEX_NONE)
+		{
+			return 0;
+		}
+		RemoveAtIndex(Index);
+		return 1;
+	}
+
+	void Remove(FSetElementId Id)
+	{
+		check(IsValidId(Id));
+		RemoveAtIndex(Id.AsInteger());
+	}
+
+	/** @return the allocated size in bytes */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Control.GetAllocatedSize() + Slots.GetAllocatedSize();
+	}
+
+private:
+	template <bool bConst>
+	class TBaseIterator
+	{
+		using SetType = typename TChooseClass<bConst, const TSwissSet, TSwissSet>::Result;
+		using ItElementType = typename TChooseClass<bConst, const ElementType, ElementType>::Result;
+
+	public:
+		FORCEINLINE TBaseIterator(SetType& InSet, int32 StartIndex)
+			: Set(InSet)
+			, Index(StartIndex)
+		{
+			SkipToFullSlot();
+		}
+
+		FORCEINLINE TBaseIterator& operator++()
+		{
+			++Index;
+			SkipToFullSlot();
+			return *this;
+		}
+
+		FORCEINLINE explicit operator bool() const
+		{
+			return Index < Set.Control.Num();
+		}
+
+		FORCEINLINE bool operator!() const
+		{
+			return !(bool)*this;
+		}
+
+		FORCEINLINE ItElementType& operator*() const
+		{
+			return Set.GetElement(Index);
+		}
+
+		FORCEINLINE ItElementType* operator->() const
+		{
+			return &Set.GetElement(Index);
+		}
+
+		FORCEINLINE FSetElementId GetId() const
+		{
+			return FSetElementId::FromInteger(Index);
+		}
+
+		FORCEINLINE friend bool operator==(const TBaseIterator& Lhs, const TBaseIterator& Rhs)
+		{
+			return &Lhs.Set == &Rhs.Set && Lhs.Index == Rhs.Index;
+		}
+
+		FORCEINLINE friend bool operator!=(const TBaseIterator& Lhs, const TBaseIterator& Rhs)
+		{
+			return !(Lhs == Rhs);
+		}
+
+	protected:
+		void SkipToFullSlot()
+		{
+			const int32 Capacity = Set.Control.Num();
+			while (Index < Capacity && Set.Control[Index] < 0)
+			{
+				++Index;
+			}
+		}
+
+		SetType& Set;
+		int32 Index;
+	};
+
+public:
+	class TConstIterator : public TBaseIterator<true>
+	{
+	public:
+		FORCEINLINE explicit TConstIterator(const TSwissSet& InSet, int32 StartIndex = 0)
+			: TBaseIterator<true>(InSet, StartIndex)
+		{
+		}
+	};
+
+	class TIterator : public TBaseIterator<false>
+	{
+	public:
+		FORCEINLINE explicit TIterator(TSwissSet& InSet, int32 StartIndex = 0)
+			: TBaseIterator<false>(InSet, StartIndex)
+		{
+		}
+
+		/** Removes the current element, the iteration continues with the next one */
+		FORCEINLINE void RemoveCurrent()
+		{
+			this->Set.RemoveAtIndex(this->Index);
+		}
+	};
+
+	FORCEINLINE TIterator CreateIterator()
+	{
+		return TIterator(*this);
+	}
+
+	FORCEINLINE TConstIterator CreateConstIterator() const
+	{
+		return TConstIterator(*this);
+	}
+
+	FORCEINLINE TIterator begin() { return TIterator(*this); }
+	FORCEINLINE TConstIterator begin() const { return TConstIterator(*this); }
+	FORCEINLINE TIterator end() { return TIterator(*this, Control.Num()); }
+	FORCEINLINE TConstIterator end() const { return TConstIterator(*this, Control.Num()); }
+
+private:
+	FORCEINLINE ElementType& GetElement(int32 Index)
+	{
+		return *Slots[Index].GetTypedPtr();
+	}
+
+	FORCEINLINE const ElementType& GetElement(int32 Index) const
+	{
+		return *Slots[Index].GetTypedPtr();
+	}
+
+	static int32 GetCapacityFor(int32 Number)
+	{
+		using namespace SwissHashTable_Private;
+		if (Number <= 0)
+		{
+			return 0;
+		}
+		int32 Capacity = GroupWidth;
+		while (GetMaxLoad(Capacity) < Number)
+		{
+			Capacity *= 2;
+		}
+		return Capacity;
+	}
+
+	template <typename ComparableKey>
+	int32 FindIndexByHash(uint32 KeyHash, const ComparableKey& Key) const
+	{
+		using namespace SwissHashTable_Private;
+		if (NumElements == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		const uint64 MixedHash = MixHash(KeyHash);
+		const int8 HashFragment = GetHashFragment(MixedHash);
+		const uint32 GroupMask = uint32(Control.Num() / GroupWidth) - 1;
+		uint32 GroupIndex = GetFirstGroup(MixedHash) & GroupMask;
+		for (uint32 Probe = 1; ; ++Probe)
+		{
+			const int32 GroupStart = int32(GroupIndex) * GroupWidth;
+			const FGroup Group(Control.GetData() + GroupStart);
+			for (FGroupMask Match = Group.Match(HashFragment); Match; Match.ClearLowestSlot())
+			{
+				const int32 Index = GroupStart + Match.LowestSlot();
+				if (KeyFuncs::Matches(KeyFuncs::GetSetKey(GetElement(Index)), Key))
+				{
+					return Index;
+				}
+			}
+			// An empty slot ends the probe sequence, elements are never placed past a group that had one when they were added
+			if (Group.MatchEmpty())
+			{
+				return INDEX_NONE;
+			}
+			// Triangular probing visits every group since the group count is a power of two
+			GroupIndex = (GroupIndex + Probe) & GroupMask;
+		}
+	}
+
+	/** Returns the first empty or deleted slot in the probe sequence of KeyHash, the set must have one */
+	int32 FindFreeSlot(uint64 MixedHash) const
+	{
+		using namespace SwissHashTable_Private;
+		const uint32 GroupMask = uint32(Control.Num() / GroupWidth) - 1;
+		uint32 GroupIndex = GetFirstGroup(MixedHash) & GroupMask;
+		for (uint32 Probe = 1; ; ++Probe)
+		{
+			const int32 GroupStart = int32(GroupIndex) * GroupWidth;
+			const FGroupMask Free = FGroup(Control.GetData() + GroupStart).MatchEmptyOrDeleted();
+			if (Free)
+			{
+				return GroupStart + Free.LowestSlot();
+			}
+			GroupIndex = (GroupIndex + Probe) & GroupMask;
+		}
+	}
+
+	/** Claims a free slot for a new element with hash KeyHash, growing the set if needed */
+	int32 AllocateSlot(uint32 KeyHash)
+	{
+		using namespace SwissHashTable_Private;
+		if (NumElements + NumDeleted + 1 > GetMaxLoad(Control.Num()))
+		{
+			// Reclaim deleted slots in place when they make up much of the load, otherwise grow
+			const int32 NewCapacity = FMath::Max(GetCapacityFor(NumElements + 1), NumDeleted > Control.Num() / 4 ? Control.Num() : Control.Num() * 2);
+			Rehash(NewCapacity);
+		}
+
+		const uint64 MixedHash = MixHash(KeyHash);
+		const int32 Index = FindFreeSlot(MixedHash);
+		if (Control[Index] == ControlDeleted)
+		{
+			--NumDeleted;
+		}
+		Control[Index] = GetHashFragment(MixedHash);
+		++NumElements;
+		return Index;
+	}
+
+	void RemoveAtIndex(int32 Index)
+	{
+		using namespace SwissHashTable_Private;
+		checkSlow(Control[Index] >= 0);
+		DestructItem(&GetElement(Index));
+
+		// The slot can only become empty if its group already ends probe sequences, otherwise lookups of elements
+		// placed past this group would stop early
+		const int32 GroupStart = Index & ~(GroupWidth - 1);
+		if (FGroup(Control.GetData() + GroupStart).MatchEmpty())
+		{
+			Control[Index] = ControlEmpty;
+		}
+		else
+		{
+			Control[Index] = ControlDeleted;
+			++NumDeleted;
+		}
+		--NumElements;
+	}
+
+	void Rehash(int32 NewCapacity)
+	{
+		using namespace SwissHashTable_Private;
+		check(NewCapacity == 0 || GetMaxLoad(NewCapacity) >= NumElements);
+
+		TArray<int8, ArrayAllocator> OldControl = MoveTemp(Control);
+		TArray<TTypeCompatibleBytes<ElementType>, ArrayAllocator> OldSlots = MoveTemp(Slots);
+		Control.Empty(NewCapacity);
+		Slots.Empty(NewCapacity);
+		Control.AddUninitialized(NewCapacity);
+		Slots.AddUninitialized(NewCapacity);
+		FMemory::Memset(Control.GetData(), uint8(ControlEmpty), NewCapacity);
+		NumDeleted = 0;
+
+		for (int32 OldIndex = 0; OldIndex < OldControl.Num(); ++OldIndex)
+		{
+			if (OldControl[OldIndex] >= 0)
+			{
+				ElementType* Element = OldSlots[OldIndex].GetTypedPtr();
+				const uint64 MixedHash = MixHash(KeyFuncs::GetKeyHash(KeyFuncs::GetSetKey(*Element)));
+				const int32 Index = FindFreeSlot(MixedHash);
+				Control[Index] = GetHashFragment(MixedHash);
+				RelocateConstructItems<ElementType>(&Slots[Index], Element, 1);
+			}
+		}
+	}
+
+	void DestructElements()
+	{
+		if (!TIsTriviallyDestructible<ElementType>::Value)
+		{
+			for (int32 Index = 0; Index < Control.Num(); ++Index)
+			{
+				if (Control[Index] >= 0)
+				{
+					DestructItem(&GetElement(Index));
+				}
+			}
+		}
+	}
+
+	TArray<int8, ArrayAllocator> Control;
+	TArray<TTypeCompatibleBytes<ElementType>, ArrayAllocator> Slots;
+	int32 NumElements = 0;
+	int32 NumDeleted = 0;
+};
+
+/**
+ * Open addressing hash map probing groups of control bytes, with the interface of TMap for unique keys.
+ */
+template <typename InKeyType, typename InValueType, typename Allocator = FDefaultSetAllocator, typename KeyFuncs = TDefaultMapHashableKeyFuncs<InKeyType, InValueType, false>>
+class TSwissMap
+{
+public:
+	using KeyType = InKeyType;
+	using ValueType = InValueType;
+	using ElementType = TPair<KeyType, ValueType>;
+	using KeyInitType = typename TTypeTraits<KeyType>::ConstInitType;
+	using ValueInitType = typename TTypeTraits<ValueType>::ConstInitType;
+
+	/** @return the number of key-value pairs */
+	FORCEINLINE int32 Num() const
+	{
+		return Pairs.Num();
+	}
+
+	FORCEINLINE void Empty(int32 ExpectedNumElements = 0)
+	{
+		Pairs.Empty(ExpectedNumElements);
+	}
+
+	FORCEINLINE void Reset()
+	{
+		Pairs.Reset();
+	}
+
+	FORCEINLINE void Reserve(int32 Number)
+	{
+		Pairs.Reserve(Number);
+	}
+
+	FORCEINLINE void Shrink()
+	{
+		Pairs.Shrink();
+	}
+
+	/** Sets the value associated with a key, replacing an existing pair with the same key */
+	template <typename InitKeyType, typename InitValueType>
+	FORCEINLINE ValueType& Add(InitKeyType&& Key, InitValueType&& Value)
+	{
+		const FSetElementId Id = Pairs.Emplace(TPairInitializer<InitKeyType&&, InitValueType&&>(Forward<InitKeyType>(Key), Forward<InitValueType>(Value)));
+		return Pairs[Id].Value;
+	}
+
+	/** Sets a default constructed value for a key, replacing an existing pair with the same key */
+	template <typename InitKeyType>
+	FORCEINLINE ValueType& Add(InitKeyType&& Key)
+	{
+		const FSetElementId Id = Pairs.Emplace(TKeyInitializer<InitKeyType&&>(Forward<InitKeyType>(Key)));
+		return Pairs[Id].Value;
+	}
+
+	template <typename InitKeyType>
+	ValueType& FindOrAdd(InitKeyType&& Key)
+	{
+		const uint32 KeyHash = KeyFuncs::GetKeyHash(Key);
+		if (ElementType* Pair = Pairs.FindByHash(KeyHash, Key))
+		{
+			return Pair->Value;
+		}
+		const FSetElementId Id = Pairs.EmplaceNewByHash(KeyHash, TKeyInitializer<InitKeyType&&>(Forward<InitKeyType>(Key)));
+		return Pairs[Id].Value;
+	}
+
+	template <typename InitKeyType, typename InitValueType>
+	ValueType& FindOrAdd(InitKeyType&& Key, InitValueType&& Value)
+	{
+		const uint32 KeyHash = KeyFuncs::GetKeyHash(Key);
+		if (ElementType* Pair = Pairs.FindByHash(KeyHash, Key))
+		{
+			return Pair->Value;
+		}
+		const FSetElementId Id = Pairs.EmplaceNewByHash(KeyHash, TPairInitializer<InitKeyType&&, InitValueType&&>(Forward<InitKeyType>(Key), Forward<InitValueType>(Value)));
+		return Pairs[Id].Value;
+	}
+
+	FORCEINLINE ValueType* Find(KeyInitType Key)
+	{
+		ElementType* Pair = Pairs.Find(Key);
+		return Pair ? &Pair->Value : nullptr;
+	}
+
+	FORCEINLINE const ValueType* Find(KeyInitType Key) const
+	{
+		return const_cast<TSwissMap*>(this)->Find(Key);
+	}
+
+	FORCEINLINE ValueType FindRef(KeyInitType Key) const
+	{
+		const ValueType* Value = Find(Key);
+		return Value ? *Value : ValueType();
+	}
+
+	FORCEINLINE ValueType& FindChecked(KeyInitType Key)
+	{
+		ValueType* Value = Find(Key);
+		check(Value != nullptr);
+		return *Value;
+	}
+
+	FORCEINLINE const ValueType& FindChecked(KeyInitType Key) const
+	{
+		return const_cast<TSwissMap*>(this)->FindChecked(Key);
+	}
+
+	FORCEINLINE bool Contains(KeyInitType Key) const
+	{
+		return Pairs.Contains(Key);
+	}
+
+	/** @return the number of pairs removed */
+	FORCEINLINE int32 Remove(KeyInitType Key)
+	{
+		return Pairs.Remove(Key);
+	}
+
+	/** Removes the pair with the key and copies out its value, @return true if the key was found */
+	bool RemoveAndCopyValue(KeyInitType Key, ValueType& OutRemovedValue)
+	{
+		const FSetElementId Id = Pairs.FindId(Key);
+		if (!Id.IsValidId())
+		{
+			return false;
+		}
+		OutRemovedValue = MoveTempIfPossible(Pairs[Id].Value);
+		Pairs.Remove(Id);
+		return true;
+	}
+
+	FORCEINLINE SIZE_T GetAllocatedSize() const
+	{
+		return Pairs.GetAllocatedSize();
+	}
+
+	using TIterator = typename TSwissSet<ElementType, KeyFuncs, Allocator>::TIterator;
+	using TConstIterator = typename TSwissSet<ElementType, KeyFuncs, Allocator>::TConstIterator;
+
+	FORCEINLINE TIterator CreateIterator() { return Pairs.CreateIterator(); }
+	FORCEINLINE TConstIterator CreateConstIterator() const { return Pairs.CreateConstIterator(); }
+
+	FORCEINLINE TIterator begin() { return Pairs.begin(); }
+	FORCEINLINE TConstIterator begin() const { return Pairs.begin(); }
+	FORCEINLINE TIterator end() { return Pairs.end(); }
+	FORCEINLINE TConstIterator end() const { return Pairs.end(); }
+
+private:
+	TSwissSet<ElementType, KeyFuncs, Allocator> Pairs;
+};
+
+} // namespace Experimental
@@ -0,0 +1,43 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+
+/**
+ * Vectorized building blocks for the platform string functions, processing 16 bytes at a time.
+ *
+ * The scans may read past the end of a string, but never across an aligned 16 byte block or a page boundary,
+ * so they can't fault. Platforms without SSE2 fall back to character loops with the same results.
+ */
+struct FGenericPlatformStringSimd
+{
+	/** Number of characters of CharType processed at once */
+	template <typename CharType>
+	static constexpr int32 GetBlockSize()
+	{
+		return 16 / sizeof(CharType);
+	}
+
+	/** Returns the length of a null-terminated string */
+	CORE_API static int32 Strlen(const WIDECHAR* String);
+
+	/** Returns the first occurrence of C in String, or nullptr. Searching for '\0' returns the terminator. */
+	CORE_API static const WIDECHAR* Strchr(const WIDECHAR* String, WIDECHAR C);
+
+	/**
+	 * Counts the leading characters that are equal in both strings, ignoring ASCII casing, and aren't null.
+	 * Only whole blocks are counted, so the result is a multiple of GetBlockSize and at most MaxCount,
+	 * and the caller needs to compare the characters from there on.
+	 */
+	CORE_API static SIZE_T CountEqualIgnoreCase(const ANSICHAR* String1, const ANSICHAR* String2, SIZE_T MaxCount);
+	CORE_API static SIZE_T CountEqualIgnoreCase(const WIDECHAR* String1, const WIDECHAR* String2, SIZE_T MaxCount);
+
+	/** Returns the number of leading characters below 0x80 among the first Count characters */
+	CORE_API static int32 CountAscii(const ANSICHAR* String, int32 Count);
+	CORE_API static int32 CountAscii(const WIDECHAR* String, int32 Count);
+
+	/** Copies Count characters below 0x80, e.g. as counted by CountAscii, to a wider or narrower character type */
+	CORE_API static void WidenAscii(WIDECHAR* Dest, const ANSICHAR* Source, int32 Count);
+	CORE_API static void NarrowAscii(ANSICHAR* Dest, const WIDECHAR* Source, int32 Count);
+};
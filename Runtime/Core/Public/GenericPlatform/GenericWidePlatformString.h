@@ -6,6 +6,7 @@
 #include "Misc/Char.h"
 #include "GenericPlatform/GenericPlatformStricmp.h"
 #include "GenericPlatform/GenericPlatformString.h"
+#include "GenericPlatform/GenericPlatformStringSimd.h"
 #include "HAL/PlatformCrt.h"
 
 #if PLATFORM_USE_GENERIC_STRING_IMPLEMENTATION
@@ -64,15 +65,7 @@ public:
 
 	CORE_API static int32 Strlen( const WIDECHAR* String )
 	{
-		int32 Length = -1;
-
-		do
-		{
-			Length++;
-		}
-		while (*String++);
-
-		return Length;
+		return FGenericPlatformStringSimd::Strlen(String);
 	}
 
 	CORE_API static int32 Strnlen( const WIDECHAR* String, SIZE_T StringSize )
@@ -118,21 +111,20 @@ public:
 
 	CORE_API static const WIDECHAR* Strstr( const WIDECHAR* String, const WIDECHAR* Find)
 	{
-		WIDECHAR Char1, Char2;
+		WIDECHAR Char1;
 		if ((Char1 = *Find++) != 0)
 		{
 			size_t Length = Strlen(Find);
 			
+			// Jump between occurrences of the first character with the vectorized Strchr
 			do
 			{
-				do
+				String = FGenericPlatformStringSimd::Strchr(String, Char1);
+				if (String == nullptr)
 				{
-					if ((Char2 = *String++) == 0)
-					{
-						return nullptr;
-					}
+					return nullptr;
 				}
-				while (Char1 != Char2);
+				String++;
 			}
 			while (Strncmp(String, Find, Length) != 0);
 			
@@ -144,12 +136,7 @@ public:
 
 	CORE_API static const WIDECHAR* Strchr( const WIDECHAR* String, WIDECHAR C)
 	{
-		while (*String != C && *String != 0)
-		{
-			String++;
-		}
-		
-		return (*String == C) ? String : nullptr;
+		return FGenericPlatformStringSimd::Strchr(String, C);
 	}
 
 	CORE_API static const WIDECHAR* Strrchr( const WIDECHAR* String, WIDECHAR C)
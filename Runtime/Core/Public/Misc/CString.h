@@ -7,6 +7,7 @@
 #include "Misc/AssertionMacros.h"
 #include "Misc/Char.h"
 #include "HAL/PlatformString.h"
+#include "String/ParseNumber.h"
 #include "Templates/IsValidVariadicFunctionArg.h"
 #include "Templates/AndOrNot.h"
 #include "Templates/IsArrayOrRefOfType.h"
@@ -316,22 +317,22 @@ struct TCString
 	static FORCEINLINE int32 Strcspn( const CharType* String, const CharType* Mask );
 
 	/**
-	 * atoi wrapper
+	 * atoi replacement, independent of the locale
 	 */
 	static FORCEINLINE int32 Atoi( const CharType* String );
 
 	/**
-	 * atoi64 wrapper
+	 * atoi64 replacement, independent of the locale
 	 */
 	static FORCEINLINE int64 Atoi64( const CharType* String );
 	
 	/**
-	 * atof wrapper
+	 * atof replacement, independent of the locale and correctly rounded
 	 */
 	static FORCEINLINE float Atof( const CharType* String );
 
 	/**
-	 * atod wrapper
+	 * atod replacement, independent of the locale and correctly rounded
 	 */
 	static FORCEINLINE double Atod( const CharType* String );
 
@@ -824,43 +825,43 @@ int32 TCString<T>::Strcspn( const CharType* String, const CharType* Mask )
 template <typename T> FORCEINLINE 
 int32 TCString<T>::Atoi( const CharType* String ) 
 {
-	return FPlatformString::Atoi(String);
+	return UE::String::Private::Atoi(String);
 }
 
 template <typename T> FORCEINLINE
 int64 TCString<T>::Atoi64( const CharType* String )
 { 
-	return FPlatformString::Atoi64(String);
+	return UE::String::Private::Strtoi64(String, nullptr, 10);
 }
 
 template <typename T> FORCEINLINE
 float TCString<T>::Atof( const CharType* String )
 { 
-	return FPlatformString::Atof(String);
+	return UE::String::Private::Atof(String);
 }
 
 template <typename T> FORCEINLINE
 double TCString<T>::Atod( const CharType* String )
 { 
-	return FPlatformString::Atod(String);
+	return UE::String::Private::Atod(String);
 }
 
 template <typename T> FORCEINLINE
 int32 TCString<T>::Strtoi( const CharType* Start, CharType** End, int32 Base ) 
 { 
-	return FPlatformString::Strtoi(Start, End, Base);
+	return UE::String::Private::Strtoi(Start, End, Base);
 }
 
 template <typename T> FORCEINLINE
 int64 TCString<T>::Strtoi64( const CharType* Start, CharType** End, int32 Base ) 
 { 
-	return FPlatformString::Strtoi64(Start, End, Base);
+	return UE::String::Private::Strtoi64(Start, End, Base);
 }
 
 template <typename T> FORCEINLINE
 uint64 TCString<T>::Strtoui64( const CharType* Start, CharType** End, int32 Base ) 
 { 
-	return FPlatformString::Strtoui64(Start, End, Base);
+	return UE::String::Private::Strtoui64(Start, End, Base);
 }
 
 
@@ -0,0 +1,330 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/StringFwd.h"
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+#include "Misc/StringBuilder.h"
+#include "Templates/Decay.h"
+#include "Templates/IsEnum.h"
+#include "Templates/IsFloatingPoint.h"
+#include "Templates/IsIntegral.h"
+#include "Templates/IsPointer.h"
+#include "Templates/RemoveCV.h"
+#include "Templates/UnrealTemplate.h"
+
+namespace UE
+{
+namespace String
+{
+namespace Private
+{
+	enum class EFormatArgType : uint8
+	{
+		Signed,
+		Unsigned,
+		Float,
+		Bool,
+		Char,
+		String,
+		AnsiString,
+		Pointer,
+		Custom,
+		Enum,
+		Unsupported,
+	};
+
+	/** A type erased reference to one argument of a format call, only valid for the duration of the call */
+	template <typename CharType>
+	struct TFormatArg
+	{
+		using FAppendFunction = void (*)(TStringBuilderBase<CharType>& Builder, const void* Value);
+
+		union
+		{
+			int64 Signed;
+			uint64 Unsigned;
+			double Float;
+			bool Bool;
+			uint32 Char;
+			const void* Pointer;
+			struct
+			{
+				const void* Data;
+				int32 Len;
+			} String;
+			struct
+			{
+				const void* Value;
+				FAppendFunction Append;
+			} Custom;
+		};
+		EFormatArgType Type = EFormatArgType::Unsupported;
+	};
+
+	template <typename T>
+	struct TIsFormatCharType
+	{
+		static constexpr bool Value = TIsSame<T, ANSICHAR>::Value || TIsSame<T, WIDECHAR>::Value || TIsSame<T, UCS2CHAR>::Value
+			|| TIsSame<T, char16_t>::Value || TIsSame<T, char32_t>::Value || TIsSame<T, wchar_t>::Value;
+	};
+
+	template <typename T, bool bIsIntegral = TIsIntegral<T>::Value>
+	struct TIsSignedIntegral
+	{
+		static constexpr bool Value = false;
+	};
+
+	template <typename T>
+	struct TIsSignedIntegral<T, true>
+	{
+		static constexpr bool Value = T(-1) < T(0);
+	};
+
+	template <typename ViewType, typename T, typename = void>
+	struct TIsConvertibleToView
+	{
+		static constexpr bool Value = false;
+	};
+
+	template <typename ViewType, typename T>
+	struct TIsConvertibleToView<ViewType, T, decltype(void(ImplicitConv<ViewType>(DeclVal<const T&>())))>
+	{
+		static constexpr bool Value = true;
+	};
+
+	template <typename CharType, typename T, typename = void>
+	struct TCanAppendToBuilder
+	{
+		static constexpr bool Value = false;
+	};
+
+	template <typename CharType, typename T>
+	struct TCanAppendToBuilder<CharType, T, decltype(void(DeclVal<TStringBuilderBase<CharType>&>() << DeclVal<const T&>()))>
+	{
+		static constexpr bool Value = true;
+	};
+
+	template <typename T>
+	struct TIsCharPointer
+	{
+		static constexpr bool Value = false;
+	};
+
+	template <typename T>
+	struct TIsCharPointer<T*>
+	{
+		static constexpr bool Value = TIsFormatCharType<typename TRemoveCV<T>::Type>::Value;
+	};
+
+	template <typename CharType, typename T>
+	struct TFormatArgTypeOf
+	{
+		static constexpr EFormatArgType Value =
+			TIsSame<T, bool>::Value ? EFormatArgType::Bool :
+			TIsFormatCharType<T>::Value ? (sizeof(T) <= sizeof(CharType) ? EFormatArgType::Char : EFormatArgType::Unsupported) :
+			TIsIntegral<T>::Value ? (TIsSignedIntegral<T>::Value ? EFormatArgType::Signed : EFormatArgType::Unsigned) :
+			TIsEnum<T>::Value ? EFormatArgType::Enum :
+			TIsFloatingPoint<T>::Value ? EFormatArgType::Float :
+			TIsConvertibleToView<TStringView<CharType>, T>::Value ? EFormatArgType::String :
+			!TIsSame<CharType, ANSICHAR>::Value && TIsConvertibleToView<FAnsiStringView, T>::Value ? EFormatArgType::AnsiString :
+			TIsCharPointer<typename TDecay<T>::Type>::Value ? EFormatArgType::Unsupported :
+			TIsPointer<typename TDecay<T>::Type>::Value || TIsSame<T, decltype(nullptr)>::Value ? EFormatArgType::Pointer :
+			TCanAppendToBuilder<CharType, T>::Value ? EFormatArgType::Custom :
+			EFormatArgType::Unsupported;
+	};
+
+	template <typename CharType, typename T, EFormatArgType Type = TFormatArgTypeOf<CharType, T>::Value>
+	struct TFormatArgMaker;
+
+	template <typename CharType, typename T>
+	struct TFormatArgMaker<CharType, T, EFormatArgType::Signed>
+	{
+		static FORCEINLINE TFormatArg<CharType> Make(const T& Value)
+		{
+			TFormatArg<CharType> Arg;
+			Arg.Type = EFormatArgType::Signed;
+			Arg.Signed = int64(Value);
+			return Arg;
+		}
+	};
+
+	template <typename CharType, typename T>
+	struct TFormatArgMaker<CharType, T, EFormatArgType::Unsigned>
+	{
+		static FORCEINLINE TFormatArg<CharType> Make(const T& Value)
+		{
+			TFormatArg<CharType> Arg;
+			Arg.Type = EFormatArgType::Unsigned;
+			Arg.Unsigned = uint64(Value);
+			return Arg;
+		}
+	};
+
+	template <typename CharType, typename T>
+	struct TFormatArgMaker<CharType, T, EFormatArgType::Float>
+	{
+		static FORCEINLINE TFormatArg<CharType> Make(const T& Value)
+		{
+			TFormatArg<CharType> Arg;
+			Arg.Type = EFormatArgType::Float;
+			Arg.Float = double(Value);
+			return Arg;
+		}
+	};
+
+	template <typename CharType, typename T>
+	struct TFormatArgMaker<CharType, T, EFormatArgType::Bool>
+	{
+		static FORCEINLINE TFormatArg<CharType> Make(const T& Value)
+		{
+			TFormatArg<CharType> Arg;
+			Arg.Type = EFormatArgType::Bool;
+			Arg.Bool = Value;
+			return Arg;
+		}
+	};
+
+	template <typename CharType, typename T>
+	struct TFormatArgMaker<CharType, T, EFormatArgType::Char>
+	{
+		static FORCEINLINE TFormatArg<CharType> Make(const T& Value)
+		{
+			TFormatArg<CharType> Arg;
+			Arg.Type = EFormatArgType::Char;
+			Arg.Char = uint32(Value);
+			return Arg;
+		}
+	};
+
+	template <typename CharType, typename T>
+	struct TFormatArgMaker<CharType, T, EFormatArgType::String>
+	{
+		static FORCEINLINE TFormatArg<CharType> Make(const T& Value)
+		{
+			const TStringView<CharType> View = ImplicitConv<TStringView<CharType>>(Value);
+			TFormatArg<CharType> Arg;
+			Arg.Type = EFormatArgType::String;
+			Arg.String.Data = View.GetData();
+			Arg.String.Len = View.Len();
+			return Arg;
+		}
+	};
+
+	template <typename CharType, typename T>
+	struct TFormatArgMaker<CharType, T, EFormatArgType::AnsiString>
+	{
+		static FORCEINLINE TFormatArg<CharType> Make(const T& Value)
+		{
+			const FAnsiStringView View = ImplicitConv<FAnsiStringView>(Value);
+			TFormatArg<CharType> Arg;
+			Arg.Type = EFormatArgType::AnsiString;
+			Arg.String.Data = View.GetData();
+			Arg.String.Len = View.Len();
+			return Arg;
+		}
+	};
+
+	template <typename CharType, typename T>
+	struct TFormatArgMaker<CharType, T, EFormatArgType::Pointer>
+	{
+		static FORCEINLINE TFormatArg<CharType> Make(const T& Value)
+		{
+			TFormatArg<CharType> Arg;
+			Arg.Type = EFormatArgType::Pointer;
+			Arg.Pointer = (const void*)Value;
+			return Arg;
+		}
+	};
+
+	template <typename CharType, typename T>
+	struct TFormatArgMaker<CharType, T, EFormatArgType::Custom>
+	{
+		static void Append(TStringBuilderBase<CharType>& Builder, const void* Value)
+		{
+			Builder << *static_cast<const T*>(Value);
+		}
+
+		static FORCEINLINE TFormatArg<CharType> Make(const T& Value)
+		{
+			TFormatArg<CharType> Arg;
+			Arg.Type = EFormatArgType::Custom;
+			Arg.Custom.Value = &Value;
+			Arg.Custom.Append = &Append;
+			return Arg;
+		}
+	};
+
+	template <typename CharType, typename T>
+	struct TFormatArgMaker<CharType, T, EFormatArgType::Enum>
+	{
+		static FORCEINLINE TFormatArg<CharType> Make(const T& Value)
+		{
+			using UnderlyingType = __underlying_type(T);
+			return TFormatArgMaker<CharType, UnderlyingType>::Make(UnderlyingType(Value));
+		}
+	};
+
+	template <typename CharType, typename T>
+	struct TFormatArgMaker<CharType, T, EFormatArgType::Unsupported>
+	{
+		static_assert(sizeof(T) == 0, "Type cannot be formatted. Implement operator<< for TStringBuilderBase, or pass a string view of a matching character type.");
+	};
+
+	template <typename CharType, typename T>
+	FORCEINLINE TFormatArg<CharType> MakeFormatArg(const T& Value)
+	{
+		return TFormatArgMaker<CharType, typename TRemoveCV<T>::Type>::Make(Value);
+	}
+
+	CORE_API FAnsiStringBuilderBase& FormatArgs(FAnsiStringBuilderBase& Builder, const ANSICHAR* Format, const TFormatArg<ANSICHAR>* Args, int32 NumArgs);
+	CORE_API FWideStringBuilderBase& FormatArgs(FWideStringBuilderBase& Builder, const WIDECHAR* Format, const TFormatArg<WIDECHAR>* Args, int32 NumArgs);
+}
+
+	/**
+	 * Appends the arguments to the builder as laid out by the format string, without going through varargs or
+	 * allocating anything beyond what the builder needs to grow.
+	 *
+	 * Replacement fields are written as {} for the next argument, or {Index} for an explicit argument, followed
+	 * by an optional :Spec. Use {{ and }} for literal braces. The spec follows [[Fill]Align][Sign][#][0][Width][.Precision][Type]:
+	 *  - Align is < for left, > for right and ^ for center. Numbers are right aligned and the rest left aligned by default.
+	 *  - Sign is + to write a sign for positive numbers too, or a space to write a space in its place.
+	 *  - # writes the 0x or 0b prefix for hex and binary integers.
+	 *  - 0 pads numbers with zeros after the sign and prefix.
+	 *  - Precision is the number of decimals for floats, and the maximum number of characters for strings.
+	 *  - Type is d for decimal, x or X for hex and b for binary integers, c for integers as characters,
+	 *    f, e or g for floats like printf, and p for pointers.
+	 *
+	 * Floats without a type are written with up to 6 decimals and trailing zeros trimmed, and like %g when very large or small.
+	 * Integers, bools, characters, enums, strings and views of either character type, and pointers are written directly.
+	 * Any other type needs an operator<< for the builder. Passing a type that can't be formatted fails to compile.
+	 * Format strings are validated as they are read, and a field referring to a missing argument asserts.
+	 *
+	 * @param Builder The builder to append to.
+	 * @param Format The null-terminated format string.
+	 * @param Args The arguments referenced by the replacement fields.
+	 *
+	 * @return The builder, to allow additional operations to be composed with this one.
+	 */
+	template <typename CharType, typename... ArgTypes>
+	inline TStringBuilderBase<CharType>& FormatTo(TStringBuilderBase<CharType>& Builder, const CharType* Format, const ArgTypes&... Args)
+	{
+		const Private::TFormatArg<CharType> FormatArgs[sizeof...(Args) + 1] = { Private::MakeFormatArg<CharType>(Args)... };
+		return Private::FormatArgs(Builder, Format, FormatArgs, int32(sizeof...(Args)));
+	}
+
+	/**
+	 * Formats the arguments into a new string. See FormatTo for the format string syntax.
+	 * Formatting happens on the stack, and the only allocation is the one for the returned string.
+	 */
+	template <typename... ArgTypes>
+	inline FString Format(const TCHAR* Fmt, const ArgTypes&... Args)
+	{
+		TStringBuilder<512> Builder;
+		FormatTo(Builder, Fmt, Args...);
+		return FString(Builder.Len(), Builder.GetData());
+	}
+}
+}
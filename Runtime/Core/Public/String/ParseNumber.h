@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/StringFwd.h"
+
+namespace UE
+{
+namespace String
+{
+	/**
+	 * Parse a floating point number from the start of the view, correctly rounded and independent of the locale.
+	 *
+	 * Accepts an optional sign, digits with an optional decimal point, an optional exponent, and inf, infinity
+	 * and nan in any case. Leading whitespace is not skipped. UTF-8 text can be parsed as ANSI.
+	 *
+	 * @param View The string view to parse from.
+	 * @param OutValue [out] The parsed value. Not modified if no number was parsed.
+	 *
+	 * @return The number of characters parsed, or 0 if the view doesn't start with a number.
+	 */
+	CORE_API int32 ParseDouble(const FAnsiStringView& View, double& OutValue);
+	CORE_API int32 ParseDouble(const FWideStringView& View, double& OutValue);
+	CORE_API int32 ParseFloat(const FAnsiStringView& View, float& OutValue);
+	CORE_API int32 ParseFloat(const FWideStringView& View, float& OutValue);
+
+	/**
+	 * Parse an integer from the start of the view, independent of the locale.
+	 *
+	 * Accepts an optional sign followed by digits in the base. A base of 16 accepts an optional 0x prefix, and a base of 0
+	 * detects the base from a 0x prefix for hexadecimal or a leading 0 for octal. Unsigned values don't accept a minus sign.
+	 * Leading whitespace is not skipped. UTF-8 text can be parsed as ANSI.
+	 *
+	 * @param View The string view to parse from.
+	 * @param OutValue [out] The parsed value. Not modified if no number was parsed.
+	 * @param Base The base of the digits, 0 or between 2 and 36.
+	 *
+	 * @return The number of characters parsed, or 0 if the view doesn't start with a number that fits in the type.
+	 */
+	CORE_API int32 ParseInteger(const FAnsiStringView& View, int64& OutValue, int32 Base = 10);
+	CORE_API int32 ParseInteger(const FWideStringView& View, int64& OutValue, int32 Base = 10);
+	CORE_API int32 ParseInteger(const FAnsiStringView& View, uint64& OutValue, int32 Base = 10);
+	CORE_API int32 ParseInteger(const FWideStringView& View, uint64& OutValue, int32 Base = 10);
+
+namespace Private
+{
+	/**
+	 * Replacements for the CRT conversions behind TCString, following the atof and strtol family:
+	 * leading whitespace is skipped, out of range integers are clamped, and unparsable strings return 0.
+	 * Strtoi is the exception and truncates the 64 bit value to 32 bits, like the platform strtol wrappers did.
+	 * Unlike the CRT they don't depend on the locale or convert wide strings to narrow ones first.
+	 * The string view overloads stop at the end of the view and otherwise give the same results.
+	 */
+	CORE_API double Atod(const ANSICHAR* String);
+	CORE_API double Atod(const WIDECHAR* String);
+	CORE_API double Atod(const FAnsiStringView& View);
+	CORE_API double Atod(const FWideStringView& View);
+	CORE_API float Atof(const ANSICHAR* String);
+	CORE_API float Atof(const WIDECHAR* String);
+	CORE_API float Atof(const FAnsiStringView& View);
+	CORE_API float Atof(const FWideStringView& View);
+	CORE_API int32 Atoi(const ANSICHAR* String);
+	CORE_API int32 Atoi(const WIDECHAR* String);
+	CORE_API int32 Atoi(const FAnsiStringView& View);
+	CORE_API int32 Atoi(const FWideStringView& View);
+	CORE_API int32 Strtoi(const ANSICHAR* Start, ANSICHAR** End, int32 Base);
+	CORE_API int32 Strtoi(const WIDECHAR* Start, WIDECHAR** End, int32 Base);
+	CORE_API int64 Strtoi64(const ANSICHAR* Start, ANSICHAR** End, int32 Base);
+	CORE_API int64 Strtoi64(const WIDECHAR* Start, WIDECHAR** End, int32 Base);
+	CORE_API int64 Strtoi64(const FAnsiStringView& View, int32 Base);
+	CORE_API int64 Strtoi64(const FWideStringView& View, int32 Base);
+	CORE_API uint64 Strtoui64(const ANSICHAR* Start, ANSICHAR** End, int32 Base);
+	CORE_API uint64 Strtoui64(const WIDECHAR* Start, WIDECHAR** End, int32 Base);
+	CORE_API uint64 Strtoui64(const FAnsiStringView& View, int32 Base);
+	CORE_API uint64 Strtoui64(const FWideStringView& View, int32 Base);
+}
+}
+}
@@ -54,6 +54,8 @@
 #include "Serialization/BulkData.h"
 #include "Serialization/LargeMemoryReader.h"
 #include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/AutomationTest.h"
 #include "UObject/UObjectClusters.h"
 #include "UObject/LinkerInstancingContext.h"
 #include "ProfilingDebugging/CountersTrace.h"
@@ -61,6 +63,8 @@
 #include "Async/ParallelFor.h"
 #include "HAL/LowLevelMemStats.h"
 #include "HAL/IPlatformFileOpenLogWrapper.h"
+#include "Hash/CityHash.h"
+#include "Misc/ScopeRWLock.h"
 
 #if UE_BUILD_DEVELOPMENT || UE_BUILD_DEBUG
 PRAGMA_DISABLE_OPTIMIZATION
@@ -196,6 +200,10 @@ void FindAllRuntimeScriptPackages(TArray<UPackage*>& OutPackages)
 #define ALT2_LOG_VERBOSE DO_CHECK
 #endif
 
+#ifndef ALT2_ENABLE_PARALLEL_EXPORT_SERIALIZATION
+#define ALT2_ENABLE_PARALLEL_EXPORT_SERIALIZATION 1
+#endif
+
 static TSet<FPackageId> GAsyncLoading2_DebugPackageIds;
 static FString GAsyncLoading2_DebugPackageNamesString;
 static TSet<FPackageId> GAsyncLoading2_VerbosePackageIds;
@@ -247,6 +255,57 @@ static FAutoConsoleVariableRef CVar_VerbosePackageNames(
 	ECVF_Default);
 #endif
 
+#if ALT2_ENABLE_PARALLEL_EXPORT_SERIALIZATION
+static int32 GAsyncLoading2_ParallelExportSerialization = 0;
+static FAutoConsoleVariableRef CVar_ParallelExportSerialization(
+	TEXT("s.ParallelExportSerialization"),
+	GAsyncLoading2_ParallelExportSerialization,
+	TEXT("If true, consecutive exports whose Serialize is thread safe (UObject::IsSerializeThreadSafe) are serialized concurrently on worker threads."),
+	ECVF_Default);
+
+static int32 GAsyncLoading2_ParallelExportSerializationMinBatch = 4;
+static FAutoConsoleVariableRef CVar_ParallelExportSerializationMinBatch(
+	TEXT("s.ParallelExportSerializationMinBatch"),
+	GAsyncLoading2_ParallelExportSerializationMinBatch,
+	TEXT("Minimum number of consecutive thread safe exports required to serialize them concurrently."),
+	ECVF_Default);
+
+static int32 GAsyncLoading2_ParallelExportSerializationMaxBatch = 256;
+static FAutoConsoleVariableRef CVar_ParallelExportSerializationMaxBatch(
+	TEXT("s.ParallelExportSerializationMaxBatch"),
+	GAsyncLoading2_ParallelExportSerializationMaxBatch,
+	TEXT("Maximum number of exports serialized concurrently before checking the async loading time limit again."),
+	ECVF_Default);
+#endif
+
+static int32 GAsyncLoading2_NameBatchCacheMaxNames = 256 * 1024;
+static FAutoConsoleVariableRef CVar_NameBatchCacheMaxNames(
+	TEXT("s.NameBatchCacheMaxNames"),
+	GAsyncLoading2_NameBatchCacheMaxNames,
+	TEXT("Maximum number of names kept in the cache of resolved package name batches. 0 disables the cache."),
+	ECVF_Default);
+
+static int32 GAsyncLoading2_PreloadTracePrecacheLookahead = 32;
+static FAutoConsoleVariableRef CVar_PreloadTracePrecacheLookahead(
+	TEXT("s.PreloadTracePrecacheLookahead"),
+	GAsyncLoading2_PreloadTracePrecacheLookahead,
+	TEXT("When replaying a package preload trace (-PackagePreloadTrace=<File>), number of upcoming traced packages whose export bundles are read ahead of demand."),
+	ECVF_Default);
+
+static int32 GAsyncLoading2_PreloadTraceLoadLookahead = 4;
+static FAutoConsoleVariableRef CVar_PreloadTraceLoadLookahead(
+	TEXT("s.PreloadTraceLoadLookahead"),
+	GAsyncLoading2_PreloadTraceLoadLookahead,
+	TEXT("When replaying a package preload trace (-PackagePreloadTrace=<File>), number of upcoming traced packages requested for async loading ahead of demand."),
+	ECVF_Default);
+
+static int32 GAsyncLoading2_PreloadTraceMaxPrecacheMB = 64;
+static FAutoConsoleVariableRef CVar_PreloadTraceMaxPrecacheMB(
+	TEXT("s.PreloadTraceMaxPrecacheMB"),
+	GAsyncLoading2_PreloadTraceMaxPrecacheMB,
+	TEXT("Maximum size in MB of export bundle reads issued ahead of demand by a package preload trace that may be in flight at once."),
+	ECVF_Default);
+
 #define UE_ASYNC_PACKAGE_DEBUG(PackageDesc) \
 if (GAsyncLoading2_DebugPackageIds.Contains((PackageDesc).DiskPackageId)) \
 { \
@@ -471,6 +530,74 @@ struct FAsyncPackageDesc2
 #endif
 };
 
+/**
+ * Process-wide cache of resolved package name batches, keyed by a hash of the batch's name hashes.
+ *
+ * Packages cooked from the same source, reloaded packages and packages that only reference common
+ * engine names often store identical name batches. Resolving a cached batch is a copy of its
+ * name entry ids instead of a hash table lookup per name under the name pool batch lock.
+ * Name entries are never freed, so cached ids stay valid for the lifetime of the process.
+ */
+class FNameBatchCache
+{
+public:
+	void Load(TArray<FNameEntryId>& OutNames, TArrayView<const uint8> NameBuffer, TArrayView<const uint8> HashBuffer)
+	{
+		if (GAsyncLoading2_NameBatchCacheMaxNames <= 0)
+		{
+			LoadNameBatch(OutNames, NameBuffer, HashBuffer);
+			return;
+		}
+
+		const uint64 Key = CityHash64(reinterpret_cast<const char*>(HashBuffer.GetData()), HashBuffer.Num());
+		{
+			FReadScopeLock ReadLock(Lock);
+			if (const FCachedBatch* CachedBatch = Batches.Find(Key))
+			{
+				if (CachedBatch->Matches(NameBuffer, HashBuffer))
+				{
+					OutNames = CachedBatch->Names;
+					return;
+				}
+			}
+		}
+
+		LoadNameBatch(OutNames, NameBuffer, HashBuffer);
+
+		FWriteScopeLock WriteLock(Lock);
+		if (NumCachedNames + OutNames.Num() <= GAsyncLoading2_NameBatchCacheMaxNames && !Batches.Contains(Key))
+		{
+			FCachedBatch& CachedBatch = Batches.Add(Key);
+			CachedBatch.NameBufferSize = NameBuffer.Num();
+			CachedBatch.HashBuffer.Append(HashBuffer.GetData(), HashBuffer.Num());
+			CachedBatch.Names = OutNames;
+			NumCachedNames += OutNames.Num();
+		}
+	}
+
+private:
+	struct FCachedBatch
+	{
+		int32 NameBufferSize = 0;
+		// Identifies the names of the batch, the hashes are computed from the lowercase names
+		// and batches differing only in name casing resolve to the same comparison entries
+		TArray<uint8> HashBuffer;
+		TArray<FNameEntryId> Names;
+
+		bool Matches(TArrayView<const uint8> InNameBuffer, TArrayView<const uint8> InHashBuffer) const
+		{
+			return NameBufferSize == InNameBuffer.Num() && HashBuffer.Num() == InHashBuffer.Num() &&
+				FMemory::Memcmp(HashBuffer.GetData(), InHashBuffer.GetData(), InHashBuffer.Num()) == 0;
+		}
+	};
+
+	FRWLock Lock;
+	TMap<uint64, FCachedBatch> Batches;
+	int32 NumCachedNames = 0;
+};
+
+static FNameBatchCache GNameBatchCache;
+
 class FNameMap
 {
 public:
@@ -508,7 +635,14 @@ public:
 
 	void Load(TArrayView<const uint8> NameBuffer, TArrayView<const uint8> HashBuffer, FMappedName::EType InNameMapType)
 	{
-		LoadNameBatch(NameEntries, NameBuffer, HashBuffer);
+		if (InNameMapType == FMappedName::EType::Package)
+		{
+			GNameBatchCache.Load(NameEntries, NameBuffer, HashBuffer);
+		}
+		else
+		{
+			LoadNameBatch(NameEntries, NameBuffer, HashBuffer);
+		}
 		NameMapType = InNameMapType;
 	}
 
@@ -1205,6 +1339,187 @@ public:
 	}
 };
 
+/**
+ * Records the order in which packages are first requested during a session and replays it on later runs.
+ *
+ * Recording is enabled with -RecordPackagePreloadTrace[=<File>] and the trace is written on exit or with
+ * s.SavePackagePreloadTrace. Replaying is enabled with -PackagePreloadTrace=<File>: each request for a traced
+ * package moves the replay cursor past it and hands out the upcoming traced packages for preloading.
+ * The trace stores the package names in request order, so it remains valid across content changes,
+ * packages that no longer exist are skipped by the loader.
+ */
+class FPackagePreloadTrace
+{
+public:
+	struct FEntry
+	{
+		FName PackageName;
+		FPackageId PackageId;
+	};
+
+	void Initialize()
+	{
+		FString ReplayFilename;
+		if (FParse::Value(FCommandLine::Get(), TEXT("-PackagePreloadTrace="), ReplayFilename))
+		{
+			LoadTrace(ReplayFilename);
+		}
+
+		if (FParse::Value(FCommandLine::Get(), TEXT("-RecordPackagePreloadTrace="), RecordFilename) ||
+			FParse::Param(FCommandLine::Get(), TEXT("RecordPackagePreloadTrace")))
+		{
+			if (RecordFilename.IsEmpty())
+			{
+				RecordFilename = FPaths::ProjectSavedDir() / TEXT("PackagePreloadTrace.bin");
+			}
+			bRecording = true;
+			FCoreDelegates::OnPreExit.AddRaw(this, &FPackagePreloadTrace::OnPreExit);
+		}
+	}
+
+	inline bool IsEnabled() const
+	{
+		return bRecording || bReplaying;
+	}
+
+	/** Records a package request and returns the traced packages that should be preloaded now. */
+	void OnPackageRequested(FName PackageName, FPackageId PackageId, TArray<FEntry>& OutPrecache, TArray<FEntry>& OutLoad)
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		if (bRecording)
+		{
+			bool bAlreadyRecorded = false;
+			RecordedPackageIds.Add(PackageId, &bAlreadyRecorded);
+			if (!bAlreadyRecorded)
+			{
+				RecordedPackages.Add(PackageName);
+			}
+		}
+
+		if (bReplaying)
+		{
+			const int32* TraceIndex = TraceIndices.Find(PackageId);
+			if (!TraceIndex || *TraceIndex < ReplayCursor)
+			{
+				return;
+			}
+			ReplayCursor = *TraceIndex + 1;
+			GatherUpcoming(NextPrecacheIndex, GAsyncLoading2_PreloadTracePrecacheLookahead, OutPrecache);
+			GatherUpcoming(NextLoadIndex, GAsyncLoading2_PreloadTraceLoadLookahead, OutLoad);
+		}
+	}
+
+	bool SaveRecording()
+	{
+		FScopeLock Lock(&CriticalSection);
+		if (!bRecording)
+		{
+			return false;
+		}
+
+		TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*RecordFilename));
+		if (!Ar)
+		{
+			UE_LOG(LogStreaming, Warning, TEXT("Failed to write package preload trace '%s'"), *RecordFilename);
+			return false;
+		}
+
+		uint32 Magic = TraceMagic;
+		uint32 Version = TraceVersion;
+		int32 PackageCount = RecordedPackages.Num();
+		*Ar << Magic << Version << PackageCount;
+		for (FName PackageName : RecordedPackages)
+		{
+			FString PackageNameStr = PackageName.ToString();
+			*Ar << PackageNameStr;
+		}
+		UE_LOG(LogStreaming, Display, TEXT("Saved package preload trace with %d packages to '%s'"), PackageCount, *RecordFilename);
+		return true;
+	}
+
+private:
+	static constexpr uint32 TraceMagic = 0x50504C54; // 'PPLT'
+	static constexpr uint32 TraceVersion = 1;
+
+	void LoadTrace(const FString& Filename)
+	{
+		TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileReader(*Filename));
+		if (!Ar)
+		{
+			UE_LOG(LogStreaming, Warning, TEXT("Failed to open package preload trace '%s'"), *Filename);
+			return;
+		}
+
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		int32 PackageCount = 0;
+		*Ar << Magic << Version << PackageCount;
+		if (Magic != TraceMagic || Version != TraceVersion || PackageCount < 0)
+		{
+			UE_LOG(LogStreaming, Warning, TEXT("Ignoring package preload trace '%s' with unknown format"), *Filename);
+			return;
+		}
+
+		TraceEntries.Reserve(PackageCount);
+		TraceIndices.Reserve(PackageCount);
+		for (int32 Index = 0; Index < PackageCount && !Ar->IsError(); ++Index)
+		{
+			FString PackageNameStr;
+			*Ar << PackageNameStr;
+			FEntry Entry;
+			Entry.PackageName = FName(*PackageNameStr);
+			Entry.PackageId = FPackageId::FromName(Entry.PackageName);
+			TraceIndices.Add(Entry.PackageId, TraceEntries.Num());
+			TraceEntries.Add(Entry);
+		}
+
+		bReplaying = !Ar->IsError() && TraceEntries.Num() > 0;
+		UE_CLOG(bReplaying, LogStreaming, Display, TEXT("Replaying package preload trace with %d packages from '%s'"), TraceEntries.Num(), *Filename);
+	}
+
+	void GatherUpcoming(int32& NextIndex, int32 Lookahead, TArray<FEntry>& OutEntries)
+	{
+		const int32 EndIndex = FMath::Min(ReplayCursor + FMath::Max(Lookahead, 0), TraceEntries.Num());
+		for (int32 Index = FMath::Max(NextIndex, ReplayCursor); Index < EndIndex; ++Index)
+		{
+			OutEntries.Add(TraceEntries[Index]);
+		}
+		NextIndex = FMath::Max(NextIndex, EndIndex);
+	}
+
+	void OnPreExit()
+	{
+		SaveRecording();
+	}
+
+	FCriticalSection CriticalSection;
+
+	FString RecordFilename;
+	TArray<FName> RecordedPackages;
+	TSet<FPackageId> RecordedPackageIds;
+	bool bRecording = false;
+
+	TArray<FEntry> TraceEntries;
+	TMap<FPackageId, int32> TraceIndices;
+	// Trace index following the most recently requested traced package
+	int32 ReplayCursor = 0;
+	// Trace indices up to which preloads have already been handed out
+	int32 NextPrecacheIndex = 0;
+	int32 NextLoadIndex = 0;
+	bool bReplaying = false;
+};
+
+static FPackagePreloadTrace GPackagePreloadTrace;
+
+static FAutoConsoleCommand SavePackagePreloadTraceCommand(
+	TEXT("s.SavePackagePreloadTrace"),
+	TEXT("Writes the package preload trace recorded with -RecordPackagePreloadTrace."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		GPackagePreloadTrace.SaveRecording();
+	}));
+
 struct FPackageImportStore
 {
 	FPackageStore& GlobalPackageStore;
@@ -1403,6 +1718,14 @@ public:
 		CookedSerialSize = 0;
 	}
 
+	/** Moves the archive past exports that were serialized through other archives */
+	void ExportBufferSkipTo(const uint8* ExportDataPtr)
+	{
+		check(CookedSerialSize == 0);
+		check(ExportDataPtr >= ActiveFPLB->StartFastPathLoadBuffer && ExportDataPtr <= ActiveFPLB->EndFastPathLoadBuffer);
+		ActiveFPLB->StartFastPathLoadBuffer = ExportDataPtr;
+	}
+
 	void CheckBufferPosition(const TCHAR* Text, uint64 Offset = 0)
 	{
 #if DO_CHECK
@@ -1587,6 +1910,9 @@ public:
 
 private:
 	friend FAsyncPackage2;
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FParallelSerializeExportsTest;
+#endif
 
 	UObject* TemplateForGetArchetypeFromLoader = nullptr;
 
@@ -2012,6 +2338,19 @@ public:
 	
 	void EventDrivenCreateExport(int32 LocalExportIndex);
 	bool EventDrivenSerializeExport(int32 LocalExportIndex, FExportArchive& Ar);
+	/** Initializes an archive used to serialize exports of this package */
+	void InitExportArchive(FExportArchive& Ar);
+#if ALT2_ENABLE_PARALLEL_EXPORT_SERIALIZATION
+	/** Returns true if the export can be serialized concurrently with other exports of this package */
+	bool CanSerializeExportInParallel(int32 LocalExportIndex) const;
+	/**
+	 * Serializes a run of consecutive serialize commands concurrently.
+	 *
+	 * @param BundleEntries Serialize commands, all exports must pass CanSerializeExportInParallel
+	 * @param ExportDataPtrs Start of the serialized data of each export
+	 */
+	void ParallelSerializeExports(TArrayView<const FExportBundleEntry> BundleEntries, TArrayView<const uint8* const> ExportDataPtrs);
+#endif
 
 	UObject* EventDrivenIndexToObject(FPackageObjectIndex Index, bool bCheckSerialized);
 	template<class T>
@@ -2233,6 +2572,9 @@ private:
 	FNameMap GlobalNameMap;
 	FPackageStore GlobalPackageStore;
 
+	/** Size of the export bundle reads issued by the package preload trace that have not completed yet */
+	TAtomic<uint64> PreloadTraceBytesInFlight { 0 };
+
 	/** Initial load pending CDOs */
 	TMap<UClass*, TArray<FEventLoadNode2*>> PendingCDOs;
 
@@ -2519,6 +2861,9 @@ private:
 	void LazyInitializeFromLoadPackage();
 	void FinalizeInitialLoad();
 
+	/** Reads the export bundles and requests async loads of the traced packages expected to be requested next */
+	void IssuePackagePreloads(FName RequestedPackageName, FPackageId RequestedPackageId);
+
 	void RemoveUnreachableObjects(const FUnreachablePublicExports& PublicExports, const FUnreachablePackages& Packages);
 
 	bool ProcessPendingCDOs()
@@ -2691,6 +3036,7 @@ void FAsyncLoadingThread2::InitializeLoading()
 #endif
 
 	GlobalPackageStore.Initialize();
+	GPackagePreloadTrace.Initialize();
 
 	AsyncThreadReady.Increment();
 
@@ -3507,34 +3853,21 @@ EAsyncPackageState::Type FAsyncPackage2::Event_ProcessExportBundle(FAsyncLoading
 	{
 		const uint64 AllExportDataSize = Package->IoBuffer.DataSize() - (Package->AllExportDataPtr - Package->IoBuffer.Data());
 		FExportArchive Ar(Package->AllExportDataPtr, Package->CurrentExportDataPtr, AllExportDataSize);
-		{
-			Ar.SetUE4Ver(Package->LinkerRoot->LinkerPackageVersion);
-			Ar.SetLicenseeUE4Ver(Package->LinkerRoot->LinkerLicenseeVersion);
-			// Ar.SetEngineVer(Summary.SavedByEngineVersion); // very old versioning scheme
-			// Ar.SetCustomVersions(LinkerRoot->LinkerCustomVersion); // only if not cooking with -unversioned
-			Ar.SetUseUnversionedPropertySerialization((Package->LinkerRoot->GetPackageFlags() & PKG_UnversionedProperties) != 0);
-			Ar.SetIsLoading(true);
-			Ar.SetIsPersistent(true);
-			if (Package->LinkerRoot->GetPackageFlags() & PKG_FilterEditorOnly)
-			{
-				Ar.SetFilterEditorOnly(true);
-			}
-			Ar.ArAllowLazyLoading = true;
-
-			// FExportArchive special fields
-			Ar.CookedHeaderSize = Package->CookedHeaderSize;
-			Ar.PackageDesc = &Package->Desc;
-			Ar.NameMap = &Package->NameMap;
-			Ar.ImportStore = &Package->ImportStore;
-			Ar.Exports = Package->Data.Exports;
-			Ar.ExportMap = Package->ExportMap;
-			Ar.ExternalReadDependencies = &Package->ExternalReadDependencies;
-		}
+		Package->InitExportArchive(Ar);
 		const FExportBundleHeader* ExportBundle = Package->Data.ExportBundleHeaders + ExportBundleIndex;
 		const FExportBundleEntry* BundleEntries = Package->Data.ExportBundleEntries + ExportBundle->FirstEntryIndex;
 		const FExportBundleEntry* BundleEntry = BundleEntries + Package->ExportBundleEntryIndex;
 		const FExportBundleEntry* BundleEntryEnd = BundleEntries + ExportBundle->EntryCount;
 		check(BundleEntry <= BundleEntryEnd);
+
+		// The exports created by the remaining bundle entries take their object indices from a single reservation
+		int32 NumExportsToCreate = 0;
+		for (const FExportBundleEntry* Entry = BundleEntry; Entry < BundleEntryEnd; ++Entry)
+		{
+			NumExportsToCreate += Entry->CommandType == FExportBundleEntry::ExportCommandType_Create ? 1 : 0;
+		}
+		FScopedUObjectIndexReservation ObjectIndexReservation(NumExportsToCreate);
+
 		while (BundleEntry < BundleEntryEnd)
 		{
 			if (ThreadState.IsTimeLimitExceeded(TEXT("Event_ProcessExportBundle")))
@@ -3553,6 +3886,45 @@ EAsyncPackageState::Type FAsyncPackage2::Event_ProcessExportBundle(FAsyncLoading
 			{
 				check(BundleEntry->CommandType == FExportBundleEntry::ExportCommandType_Serialize);
 
+#if ALT2_ENABLE_PARALLEL_EXPORT_SERIALIZATION
+				if (GAsyncLoading2_ParallelExportSerialization)
+				{
+					// All exports created so far precede this run in the bundle, so a run of consecutive serialize
+					// commands only depends on objects that already exist and can be serialized in any order.
+					const int32 MaxBatchSize = FMath::Max(GAsyncLoading2_ParallelExportSerializationMaxBatch, 1);
+					TArray<const uint8*, TInlineAllocator<64>> ExportDataPtrs;
+					const uint8* ExportDataPtr = Package->CurrentExportDataPtr;
+					const FExportBundleEntry* BatchEntry = BundleEntry;
+					while (BatchEntry < BundleEntryEnd && ExportDataPtrs.Num() < MaxBatchSize &&
+						BatchEntry->CommandType == FExportBundleEntry::ExportCommandType_Serialize)
+					{
+						const FExportMapEntry& BatchExportMapEntry = Package->ExportMap[BatchEntry->LocalExportIndex];
+						Package->Data.Exports[BatchEntry->LocalExportIndex].bFiltered = FilterExport(BatchExportMapEntry.FilterFlags);
+						if (!Package->CanSerializeExportInParallel(BatchEntry->LocalExportIndex))
+						{
+							break;
+						}
+						ExportDataPtrs.Add(ExportDataPtr);
+						ExportDataPtr += BatchExportMapEntry.CookedSerialSize;
+						++BatchEntry;
+					}
+
+					const int32 BatchSize = ExportDataPtrs.Num();
+					if (BatchSize > 1 && BatchSize >= GAsyncLoading2_ParallelExportSerializationMinBatch)
+					{
+						check(ExportDataPtr <= Package->IoBuffer.Data() + Package->IoBuffer.DataSize());
+						Package->ParallelSerializeExports(TArrayView<const FExportBundleEntry>(BundleEntry, BatchSize), ExportDataPtrs);
+
+						// Keep the sequential archive in sync with the data consumed by the batch
+						Ar.ExportBufferSkipTo(ExportDataPtr);
+						Package->CurrentExportDataPtr = ExportDataPtr;
+						BundleEntry = BatchEntry;
+						Package->ExportBundleEntryIndex += BatchSize;
+						continue;
+					}
+				}
+#endif
+
 				const uint64 CookedSerialSize = ExportMapEntry.CookedSerialSize;
 				UObject* Object = Export.Object;
 
@@ -3619,6 +3991,121 @@ EAsyncPackageState::Type FAsyncPackage2::Event_ProcessExportBundle(FAsyncLoading
 	return EAsyncPackageState::Complete;
 }
 
+void FAsyncPackage2::InitExportArchive(FExportArchive& Ar)
+{
+	Ar.SetUE4Ver(LinkerRoot->LinkerPackageVersion);
+	Ar.SetLicenseeUE4Ver(LinkerRoot->LinkerLicenseeVersion);
+	// Ar.SetEngineVer(Summary.SavedByEngineVersion); // very old versioning scheme
+	// Ar.SetCustomVersions(LinkerRoot->LinkerCustomVersion); // only if not cooking with -unversioned
+	Ar.SetUseUnversionedPropertySerialization((LinkerRoot->GetPackageFlags() & PKG_UnversionedProperties) != 0);
+	Ar.SetIsLoading(true);
+	Ar.SetIsPersistent(true);
+	if (LinkerRoot->GetPackageFlags() & PKG_FilterEditorOnly)
+	{
+		Ar.SetFilterEditorOnly(true);
+	}
+	Ar.ArAllowLazyLoading = true;
+
+	// FExportArchive special fields
+	Ar.CookedHeaderSize = CookedHeaderSize;
+	Ar.PackageDesc = &Desc;
+	Ar.NameMap = &NameMap;
+	Ar.ImportStore = &ImportStore;
+	Ar.Exports = Data.Exports;
+	Ar.ExportMap = ExportMap;
+	Ar.ExternalReadDependencies = &ExternalReadDependencies;
+}
+
+#if ALT2_ENABLE_PARALLEL_EXPORT_SERIALIZATION
+/**
+ * Serializes a batch of exports on worker threads, each from its own export archive positioned at the export data
+ *
+ * @param PackageName Name of the package the exports belong to, for error messages
+ * @param ExportMap Export map of the package
+ * @param BundleEntries Serialize commands of the batch
+ * @param ExportDataPtrs Start of the serialized data of each export in the batch
+ * @param AllExportDataPtr Start of the data of all exports of the package
+ * @param AllExportDataSize Size of the data of all exports of the package
+ * @param InitArchive Called with each archive and the index of its export in the batch before the export is serialized
+ * @param SerializeExport Serializes an export from the archive, returns false if the export was skipped
+ */
+template <typename InitArchiveFuncType, typename SerializeExportFuncType>
+static void ParallelSerializeExportBatch(FName PackageName, const FExportMapEntry* ExportMap, TArrayView<const FExportBundleEntry> BundleEntries, TArrayView<const uint8* const> ExportDataPtrs,
+	const uint8* AllExportDataPtr, uint64 AllExportDataSize, InitArchiveFuncType&& InitArchive, SerializeExportFuncType&& SerializeExport)
+{
+	check(BundleEntries.Num() == ExportDataPtrs.Num());
+
+	ParallelFor(BundleEntries.Num(), [&](int32 Index)
+	{
+		const int32 LocalExportIndex = BundleEntries[Index].LocalExportIndex;
+		const FExportMapEntry& ExportMapEntry = ExportMap[LocalExportIndex];
+		const uint64 CookedSerialSize = ExportMapEntry.CookedSerialSize;
+
+		FExportArchive Ar(AllExportDataPtr, ExportDataPtrs[Index], AllExportDataSize);
+		InitArchive(Ar, Index);
+
+		Ar.ExportBufferBegin(ExportMapEntry.CookedSerialOffset, CookedSerialSize);
+		const int64 Pos = Ar.Tell();
+		checkf(CookedSerialSize <= uint64(Ar.TotalSize() - Pos),
+			TEXT("Package %s: Expected read size: %llu - Remaining archive size: %llu"),
+			*PackageName.ToString(), CookedSerialSize, uint64(Ar.TotalSize() - Pos));
+
+		const bool bSerialized = SerializeExport(LocalExportIndex, Ar);
+		if (!bSerialized)
+		{
+			Ar.Skip(CookedSerialSize);
+		}
+		checkf(CookedSerialSize == uint64(Ar.Tell() - Pos),
+			TEXT("Package %s: Expected read size: %llu - Actual read size: %llu"),
+			*PackageName.ToString(), CookedSerialSize, uint64(Ar.Tell() - Pos));
+
+		Ar.ExportBufferEnd();
+	});
+}
+
+bool FAsyncPackage2::CanSerializeExportInParallel(int32 LocalExportIndex) const
+{
+	const FExportObject& ExportObject = Data.Exports[LocalExportIndex];
+	const UObject* Object = ExportObject.Object;
+	if (!Object || ExportObject.bFiltered || ExportObject.bExportLoadFailed || !ExportObject.TemplateObject)
+	{
+		return false;
+	}
+	// CDOs and structs are serialized through their class and need their super struct bound first
+	if (!Object->HasAnyFlags(RF_NeedLoad) || Object->HasAnyFlags(RF_ClassDefaultObject) || Object->IsA(UStruct::StaticClass()))
+	{
+		return false;
+	}
+	return Object->IsSerializeThreadSafe();
+}
+
+void FAsyncPackage2::ParallelSerializeExports(TArrayView<const FExportBundleEntry> BundleEntries, TArrayView<const uint8* const> ExportDataPtrs)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ParallelSerializeExports);
+
+	// External read callbacks are gathered per export and appended in bundle order afterwards
+	TArray<TArray<FExternalReadCallback>> ExportExternalReadDependencies;
+	ExportExternalReadDependencies.SetNum(BundleEntries.Num());
+
+	ParallelSerializeExportBatch(Desc.DiskPackageName, ExportMap, BundleEntries, ExportDataPtrs, AllExportDataPtr, IoBuffer.DataSize() - (AllExportDataPtr - IoBuffer.Data()),
+		[this, &ExportExternalReadDependencies](FExportArchive& Ar, int32 BatchIndex)
+		{
+			InitExportArchive(Ar);
+			Ar.ExternalReadDependencies = &ExportExternalReadDependencies[BatchIndex];
+		},
+		[this](int32 LocalExportIndex, FExportArchive& Ar)
+		{
+			FScopedAsyncPackageEvent2 Scope(this);
+			return EventDrivenSerializeExport(LocalExportIndex, Ar);
+		});
+
+	for (TArray<FExternalReadCallback>& Callbacks : ExportExternalReadDependencies)
+	{
+		ExternalReadDependencies.Append(MoveTemp(Callbacks));
+	}
+}
+#endif // ALT2_ENABLE_PARALLEL_EXPORT_SERIALIZATION
+
 UObject* FAsyncPackage2::EventDrivenIndexToObject(FPackageObjectIndex Index, bool bCheckSerialized)
 {
 	UObject* Result = nullptr;
@@ -4782,6 +5269,67 @@ void FAsyncLoadingThread2::LazyInitializeFromLoadPackage()
 	IoDispatcher.OnContainerMounted().AddRaw(&GlobalPackageStore, &FPackageStore::OnContainerMounted);
 }
 
+void FAsyncLoadingThread2::IssuePackagePreloads(FName RequestedPackageName, FPackageId RequestedPackageId)
+{
+	// Requests issued from here are not demand and must neither be recorded nor advance the replay
+	static thread_local bool bIssuingPreloads = false;
+	if (bIssuingPreloads)
+	{
+		return;
+	}
+
+	TArray<FPackagePreloadTrace::FEntry> PrecacheEntries;
+	TArray<FPackagePreloadTrace::FEntry> LoadEntries;
+	GPackagePreloadTrace.OnPackageRequested(RequestedPackageName, RequestedPackageId, PrecacheEntries, LoadEntries);
+	if (PrecacheEntries.Num() == 0 && LoadEntries.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(IssuePackagePreloads);
+	auto IsLoadedOrLoading = [this](const FPackagePreloadTrace::FEntry& Entry)
+	{
+		return GetAsyncPackage(Entry.PackageId) != nullptr || FindObjectFast<UPackage>(nullptr, Entry.PackageName) != nullptr;
+	};
+
+	// The export bundle reads are only issued to have the data in the platform file cache by the time the package is loaded,
+	// the buffers are dropped on completion
+	const uint64 MaxPrecacheBytes = uint64(FMath::Max(GAsyncLoading2_PreloadTraceMaxPrecacheMB, 0)) << 20;
+	FIoBatch IoBatch = IoDispatcher.NewBatch();
+	for (const FPackagePreloadTrace::FEntry& Entry : PrecacheEntries)
+	{
+		const FPackageStoreEntry* StoreEntry = GlobalPackageStore.FindStoreEntry(Entry.PackageId);
+		if (!StoreEntry || IsLoadedOrLoading(Entry))
+		{
+			continue;
+		}
+		const uint64 ReadSize = StoreEntry->ExportBundlesSize;
+		if (PreloadTraceBytesInFlight + ReadSize > MaxPrecacheBytes)
+		{
+			break;
+		}
+		PreloadTraceBytesInFlight += ReadSize;
+		IoBatch.ReadWithCallback(CreateIoChunkId(Entry.PackageId.Value(), 0, EIoChunkType::ExportBundleData),
+			FIoReadOptions(),
+			IoDispatcherPriority_Low,
+			[this, ReadSize](TIoStatusOr<FIoBuffer> Result)
+		{
+			PreloadTraceBytesInFlight -= ReadSize;
+		});
+	}
+	IoBatch.Issue();
+
+	// Preload requests use the default priority since the priority of a package is not raised when it is requested again on demand
+	TGuardValue<bool> GuardIssuingPreloads(bIssuingPreloads, true);
+	for (const FPackagePreloadTrace::FEntry& Entry : LoadEntries)
+	{
+		if (!IsLoadedOrLoading(Entry) && GlobalPackageStore.FindStoreEntry(Entry.PackageId))
+		{
+			LoadPackage(Entry.PackageName.ToString(), nullptr, nullptr, FLoadPackageAsyncDelegate(), PKG_None, INDEX_NONE, 0, nullptr);
+		}
+	}
+}
+
 
 void FAsyncLoadingThread2::FinalizeInitialLoad()
 {
@@ -5755,6 +6303,11 @@ int32 FAsyncLoadingThread2::LoadPackage(const FString& InName, const FGuid* InGu
 		QueuePackage(PackageDesc);
 
 		UE_ASYNC_PACKAGE_LOG(Verbose, PackageDesc, TEXT("LoadPackage: QueuePackage"), TEXT("Package added to pending queue."));
+
+		if (GPackagePreloadTrace.IsEnabled() && !bHasCustomPackageName)
+		{
+			IssuePackagePreloads(DiskPackageName, DiskPackageId);
+		}
 	}
 	else
 	{
@@ -5887,6 +6440,124 @@ IAsyncPackageLoader* MakeAsyncPackageLoader2(FIoDispatcher& InIoDispatcher)
 	return new FAsyncLoadingThread2(InIoDispatcher);
 }
 
+#if WITH_DEV_AUTOMATION_TESTS && ALT2_ENABLE_PARALLEL_EXPORT_SERIALIZATION
+
+/** Writes object references as export indices, the way FExportArchive reads them */
+class FParallelSerializeExportsTestWriter final : public FMemoryWriter
+{
+public:
+	FParallelSerializeExportsTestWriter(TArray<uint8>& InBytes, const TMap<UObject*, int32>& InExportIndices)
+		: FMemoryWriter(InBytes, /* bIsPersistent */ true, /* bSetOffset */ true)
+		, ExportIndices(InExportIndices)
+	{
+		SetUseUnversionedPropertySerialization(true);
+	}
+
+	using FMemoryWriter::operator<<;
+	virtual FArchive& operator<<(UObject*& Object) override
+	{
+		FPackageIndex Index = Object ? FPackageIndex::FromExport(ExportIndices.FindChecked(Object)) : FPackageIndex();
+		return *this << Index;
+	}
+
+private:
+	const TMap<UObject*, int32>& ExportIndices;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParallelSerializeExportsTest, "System.CoreUObject.Serialization.AsyncLoading2.ParallelSerializeExports", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FParallelSerializeExportsTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumExports = 64;
+	constexpr int32 SkippedExport = 7;
+	constexpr uint64 CookedHeaderSize = 1024;
+
+	// Redirectors referencing each other are saved, then loaded into other redirectors on worker threads
+	UPackage* Package = NewObject<UPackage>(nullptr, MakeUniqueObjectName(nullptr, UPackage::StaticClass(), TEXT("/Temp/ParallelSerializeExportsTest")), RF_Transient);
+	TArray<UObjectRedirector*> SavedObjects;
+	TArray<UObjectRedirector*> LoadedObjects;
+	TMap<UObject*, int32> ExportIndices;
+	for (int32 Index = 0; Index < NumExports; ++Index)
+	{
+		SavedObjects.Add(NewObject<UObjectRedirector>(Package));
+		LoadedObjects.Add(NewObject<UObjectRedirector>(Package));
+		ExportIndices.Add(SavedObjects[Index], Index);
+	}
+
+	TArray<uint8> ExportData;
+	TArray<FExportMapEntry> ExportMap;
+	TArray<FExportObject> Exports;
+	TArray<FExportBundleEntry> BundleEntries;
+	ExportMap.SetNum(NumExports);
+	Exports.SetNum(NumExports);
+	for (int32 Index = 0; Index < NumExports; ++Index)
+	{
+		SavedObjects[Index]->DestinationObject = SavedObjects[(Index + 1) % NumExports];
+
+		const int32 Offset = ExportData.Num();
+		FParallelSerializeExportsTestWriter Writer(ExportData, ExportIndices);
+		SavedObjects[Index]->Serialize(Writer);
+		ExportMap[Index].CookedSerialOffset = CookedHeaderSize + Offset;
+		ExportMap[Index].CookedSerialSize = ExportData.Num() - Offset;
+
+		Exports[Index].Object = LoadedObjects[Index];
+		Exports[Index].TemplateObject = UObjectRedirector::StaticClass()->GetDefaultObject();
+
+		FExportBundleEntry& BundleEntry = BundleEntries.AddDefaulted_GetRef();
+		BundleEntry.LocalExportIndex = Index;
+		BundleEntry.CommandType = FExportBundleEntry::ExportCommandType_Serialize;
+	}
+
+	TArray<const uint8*> ExportDataPtrs;
+	for (const FExportMapEntry& ExportMapEntry : ExportMap)
+	{
+		ExportDataPtrs.Add(ExportData.GetData() + (ExportMapEntry.CookedSerialOffset - CookedHeaderSize));
+	}
+
+	TArray<TArray<FExternalReadCallback>> ExternalReadDependencies;
+	ExternalReadDependencies.SetNum(NumExports);
+	ParallelSerializeExportBatch(Package->GetFName(), ExportMap.GetData(), BundleEntries, ExportDataPtrs, ExportData.GetData(), ExportData.Num(),
+		[&Exports, &ExportMap, &ExternalReadDependencies](FExportArchive& Ar, int32 BatchIndex)
+		{
+			Ar.SetIsLoading(true);
+			Ar.SetIsPersistent(true);
+			Ar.SetUseUnversionedPropertySerialization(true);
+			Ar.CookedHeaderSize = CookedHeaderSize;
+			Ar.Exports = Exports;
+			Ar.ExportMap = ExportMap.GetData();
+			Ar.ExternalReadDependencies = &ExternalReadDependencies[BatchIndex];
+		},
+		[&Exports](int32 LocalExportIndex, FExportArchive& Ar)
+		{
+			if (LocalExportIndex == SkippedExport)
+			{
+				return false;
+			}
+			Ar.TemplateForGetArchetypeFromLoader = Exports[LocalExportIndex].TemplateObject;
+			Exports[LocalExportIndex].Object->Serialize(Ar);
+			Ar.TemplateForGetArchetypeFromLoader = nullptr;
+			return true;
+		});
+
+	bool bResolved = true;
+	for (int32 Index = 0; Index < NumExports; ++Index)
+	{
+		UObject* ExpectedObject = Index == SkippedExport ? nullptr : LoadedObjects[(Index + 1) % NumExports];
+		bResolved &= LoadedObjects[Index]->DestinationObject == ExpectedObject;
+	}
+	TestTrue(TEXT("Exports serialized on worker threads resolve their references, skipped exports are left alone"), bResolved);
+
+	for (int32 Index = 0; Index < NumExports; ++Index)
+	{
+		SavedObjects[Index]->MarkPendingKill();
+		LoadedObjects[Index]->MarkPendingKill();
+	}
+	Package->MarkPendingKill();
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && ALT2_ENABLE_PARALLEL_EXPORT_SERIALIZATION
+
 #endif //WITH_ASYNCLOADING2
 
 #if UE_BUILD_DEVELOPMENT || UE_BUILD_DEBUG
@@ -1278,6 +1278,22 @@ IBulkDataIORequest* FBulkDataBase::CreateStreamingRequestForRange(const BulkData
 	}
 }
 
+bool FBulkDataBase::ReadRange(FIoBatch& Batch, int64 OffsetInBulkData, int64 BytesToRead, int32 Priority, FIoReadCallback&& Callback, void* TargetVa) const
+{
+	if (!IsUsingIODispatcher())
+	{
+		return false;
+	}
+
+	checkf(OffsetInBulkData >= 0 && BytesToRead >= 0 && OffsetInBulkData + BytesToRead <= BulkDataSize, TEXT("Attempting to read past the end of BulkData"));
+
+	FIoReadOptions Options(BulkDataOffset + OffsetInBulkData, BytesToRead);
+	Options.SetTargetVa(TargetVa);
+	Batch.ReadWithCallback(CreateChunkId(), Options, Priority, MoveTemp(Callback));
+
+	return true;
+}
+
 void FBulkDataBase::ForceBulkDataResident()
 {
 	// First wait for any async load requests to finish
@@ -2,7 +2,9 @@
 
 #include "Serialization/UnversionedPropertySerialization.h"
 #include "Serialization/UnversionedPropertySerializationTest.h"
+#include "HAL/IConsoleManager.h"
 #include "Interfaces/ITargetPlatform.h"
+#include "Misc/ByteSwap.h"
 #include "Misc/ScopeRWLock.h"
 #include "UObject/UnrealType.h"
 
@@ -15,6 +17,26 @@
 #	define CACHE_UNVERSIONED_PROPERTY_SCHEMA (PLATFORM_CPU_X86_FAMILY && PLATFORM_64BITS)
 #endif
 
+// Copies runs of consecutive integer-serialized values that are adjacent in memory with a single
+// FArchive::Serialize() call and zeroes runs of zero values with a single memset.
+//
+// Needs the cached schema to precompute run lengths.
+#ifndef UNVERSIONED_PROPERTY_BULK_SERIALIZATION
+#	define UNVERSIONED_PROPERTY_BULK_SERIALIZATION CACHE_UNVERSIONED_PROPERTY_SCHEMA
+#endif
+
+#if UNVERSIONED_PROPERTY_BULK_SERIALIZATION
+static_assert(CACHE_UNVERSIONED_PROPERTY_SCHEMA, "UNVERSIONED_PROPERTY_BULK_SERIALIZATION requires CACHE_UNVERSIONED_PROPERTY_SCHEMA");
+
+static int32 GUnversionedPropertyBulkSerialization = 1;
+static FAutoConsoleVariableRef CVarUnversionedPropertyBulkSerialization(
+	TEXT("s.UnversionedPropertyBulkSerialization"),
+	GUnversionedPropertyBulkSerialization,
+	TEXT("Serialize runs of adjacent numeric unversioned properties with a single block copy"),
+	ECVF_Default
+);
+#endif
+
 // Helper to pass around appropriate default value types depending on CACHE_UNVERSIONED_PROPERTY_SCHEMA
 struct FDefaultStruct
 {
@@ -45,6 +67,9 @@ public:
 		, bSerializeAsInteger(CanSerializeAsInteger(Property))
 		, IntType(GetIntType(Property->GetMinAlignment()))
 		, FastZeroIntNum(CanSerializeAsZero(InProperty, IntType) ? GetIntNum(InProperty, IntType) : uint8(0))
+#if UNVERSIONED_PROPERTY_BULK_SERIALIZATION
+		, BulkNum(0)
+#endif
 #else
 		, ArrayIndex(InArrayIndex)
 #endif
@@ -141,6 +166,52 @@ public:
 		return Property->Identical(GetValue(Data), GetDefaultValue(Defaults), PortFlags);
 	}
 
+#if UNVERSIONED_PROPERTY_BULK_SERIALIZATION
+	// Number of values starting with this one that are stored back-to-back in memory and
+	// serialized as single integers, i.e. can be copied as one block. 0 if not bulk serializable.
+	uint32 GetBulkNum() const
+	{
+		return BulkNum;
+	}
+
+	// Computes BulkNum for every serializer in a schema
+	static void InitBulkNums(FUnversionedPropertySerializer* Serializers, uint32 Num)
+	{
+		for (uint32 Idx = Num; Idx-- > 0; )
+		{
+			FUnversionedPropertySerializer& Serializer = Serializers[Idx];
+			if (Serializer.CanBulkSerialize())
+			{
+				const FUnversionedPropertySerializer* NextSerializer = Idx + 1 < Num ? &Serializers[Idx + 1] : nullptr;
+				const bool bAdjacent = NextSerializer && NextSerializer->BulkNum > 0 && NextSerializer->Offset == Serializer.Offset + GetSizeOf(Serializer.IntType);
+				Serializer.BulkNum = static_cast<uint8>(bAdjacent ? FMath::Min<uint32>(NextSerializer->BulkNum + 1, MAX_uint8) : 1);
+			}
+		}
+	}
+
+	// Serializes Num bulk serializable values starting at First with a single FArchive::Serialize() call
+	static void SerializeBulk(FArchive& Ar, const FUnversionedPropertySerializer* First, uint32 Num, uint8* Data)
+	{
+		checkSlow(Num > 0 && Num <= First->BulkNum);
+		Ar.Serialize(First->GetValue(Data), GetBulkSize(First, Num));
+
+		if (Ar.IsLoading() && Ar.IsByteSwapping())
+		{
+			for (const FUnversionedPropertySerializer* It = First, *End = First + Num; It != End; ++It)
+			{
+				ByteSwapInPlace(It->GetValue(Data), It->IntType);
+			}
+		}
+	}
+
+	// Zeroes Num bulk serializable values starting at First with a single memset
+	static void LoadZeroBulk(const FUnversionedPropertySerializer* First, uint32 Num, uint8* Data)
+	{
+		checkSlow(Num > 0 && Num <= First->BulkNum);
+		FMemory::Memzero(First->GetValue(Data), GetBulkSize(First, Num));
+	}
+#endif
+
 private:
 	enum class EIntegerType : uint8 { Uint8, Uint16, Uint32, Uint64 };
 
@@ -172,6 +243,32 @@ private:
 		}
 	}
 
+#if UNVERSIONED_PROPERTY_BULK_SERIALIZATION
+	// Integer serialized and zeroed as a single integer, i.e. the value size matches its alignment
+	bool CanBulkSerialize() const
+	{
+		return bSerializeAsInteger && FastZeroIntNum == 1;
+	}
+
+	static uint32 GetBulkSize(const FUnversionedPropertySerializer* First, uint32 Num)
+	{
+		const FUnversionedPropertySerializer& Last = First[Num - 1];
+		return Last.Offset + GetSizeOf(Last.IntType) - First->Offset;
+	}
+
+	static void ByteSwapInPlace(void* Value, EIntegerType IntType)
+	{
+		switch (IntType)
+		{
+			case  EIntegerType::Uint8:	break;
+			case EIntegerType::Uint16: *reinterpret_cast<uint16*>(Value) = BYTESWAP_ORDER16(*reinterpret_cast<uint16*>(Value)); break;
+			case EIntegerType::Uint32: *reinterpret_cast<uint32*>(Value) = BYTESWAP_ORDER32(*reinterpret_cast<uint32*>(Value)); break;
+			case EIntegerType::Uint64: *reinterpret_cast<uint64*>(Value) = BYTESWAP_ORDER64(*reinterpret_cast<uint64*>(Value)); break;
+			default: UE_ASSUME(0);
+		}
+	}
+#endif
+
 	static bool CanSerializeAsInteger(FProperty* Property)
 	{
 		uint64 CastFlags = Property->GetClass()->GetCastFlags();
@@ -268,6 +365,9 @@ private:
 	bool bSerializeAsInteger;
 	EIntegerType IntType;
 	uint8 FastZeroIntNum;
+#if UNVERSIONED_PROPERTY_BULK_SERIALIZATION
+	uint8 BulkNum;
+#endif
 #else
 	uint32 ArrayIndex;
 #endif
@@ -299,6 +399,9 @@ struct FUnversionedStructSchema
 		FUnversionedStructSchema* Schema = reinterpret_cast<FUnversionedStructSchema*>(FMemory::Malloc(Bytes, alignof(FUnversionedPropertySerializer)));
 		Schema->Num = Serializers.Num();
 		FMemory::Memcpy(Schema->Serializers, Serializers.GetData(), Serializers.Num() * sizeof(FUnversionedPropertySerializer));
+#if UNVERSIONED_PROPERTY_BULK_SERIALIZATION
+		FUnversionedPropertySerializer::InitBulkNums(Schema->Serializers, Schema->Num);
+#endif
 
 		return Schema;
 	}
@@ -615,6 +718,43 @@ public:
 			return !FragmentIt->bHasAnyZeroes || !ZeroMask[ZeroMaskIndex];
 		}
 
+#if UNVERSIONED_PROPERTY_BULK_SERIALIZATION
+		const FUnversionedPropertySerializer* GetSerializerPtr() const
+		{
+			check(SchemaIt != SchemaEnd);
+			return SchemaIt;
+		}
+
+		// Number of values starting with the current one, up to MaxNum, that belong to
+		// the current fragment and are all either zero or non-zero
+		uint32 GetUniformValueNum(uint32 MaxNum) const
+		{
+			const uint32 Num = FMath::Min(MaxNum, RemainingFragmentValues);
+			if (FragmentIt->bHasAnyZeroes)
+			{
+				const bool bIsZero = ZeroMask[ZeroMaskIndex];
+				for (uint32 Idx = 1; Idx < Num; ++Idx)
+				{
+					if (ZeroMask[ZeroMaskIndex + Idx] != bIsZero)
+					{
+						return Idx;
+					}
+				}
+			}
+			return Num;
+		}
+
+		// Advances past Num values of the current fragment, see GetUniformValueNum()
+		void Advance(uint32 Num)
+		{
+			check(Num > 0 && Num <= RemainingFragmentValues);
+			SchemaIt += Num - 1;
+			RemainingFragmentValues -= Num - 1;
+			ZeroMaskIndex += FragmentIt->bHasAnyZeroes ? Num - 1 : 0;
+			Next();
+		}
+#endif
+
 	private:
 		FUnversionedSchemaIterator SchemaIt;
 		const FZeroMask& ZeroMask;
@@ -787,6 +927,41 @@ void SerializeUnversionedProperties(const UStruct* Struct, FStructuredArchive::F
 				FDefaultStruct Defaults(DefaultsData, DefaultsStruct);
 
 				FStructuredArchive::FStream ValueStream = StructRecord.EnterStream(SA_FIELD_NAME(TEXT("Values")));
+#if UNVERSIONED_PROPERTY_BULK_SERIALIZATION
+				if (GUnversionedPropertyBulkSerialization && !UnderlyingArchive.IsTextFormat())
+				{
+					for (FUnversionedHeader::FIterator It(Header, Schema); It; )
+					{
+						const FUnversionedPropertySerializer* Serializer = It.GetSerializerPtr();
+						const uint32 Num = It.GetUniformValueNum(Serializer->GetBulkNum());
+						if (Num > 1)
+						{
+							if (It.IsNonZero())
+							{
+								FUnversionedPropertySerializer::SerializeBulk(ValueStream.EnterElement().GetUnderlyingArchive(), Serializer, Num, Data);
+							}
+							else
+							{
+								FUnversionedPropertySerializer::LoadZeroBulk(Serializer, Num, Data);
+							}
+							It.Advance(Num);
+						}
+						else
+						{
+							if (It.IsNonZero())
+							{
+								Serializer->Serialize(ValueStream.EnterElement(), Data, Defaults);
+							}
+							else
+							{
+								Serializer->LoadZero(Data);
+							}
+							It.Next();
+						}
+					}
+				}
+				else
+#endif
 				for (FUnversionedHeader::FIterator It(Header, Schema); It; It.Next())
 				{
 					if (It.IsNonZero())
@@ -801,6 +976,28 @@ void SerializeUnversionedProperties(const UStruct* Struct, FStructuredArchive::F
 			}
 			else
 			{
+#if UNVERSIONED_PROPERTY_BULK_SERIALIZATION
+				if (GUnversionedPropertyBulkSerialization)
+				{
+					for (FUnversionedHeader::FIterator It(Header, Schema); It; )
+					{
+						check(!It.IsNonZero());
+						const FUnversionedPropertySerializer* Serializer = It.GetSerializerPtr();
+						const uint32 Num = It.GetUniformValueNum(Serializer->GetBulkNum());
+						if (Num > 1)
+						{
+							FUnversionedPropertySerializer::LoadZeroBulk(Serializer, Num, Data);
+							It.Advance(Num);
+						}
+						else
+						{
+							Serializer->LoadZero(Data);
+							It.Next();
+						}
+					}
+				}
+				else
+#endif
 				for (FUnversionedHeader::FIterator It(Header, Schema); It; It.Next())
 				{
 					check(!It.IsNonZero());
@@ -841,6 +1038,31 @@ void SerializeUnversionedProperties(const UStruct* Struct, FStructuredArchive::F
 		if (Header.HasNonZeroValues())
 		{
 			FStructuredArchive::FStream ValueStream = StructRecord.EnterStream(SA_FIELD_NAME(TEXT("Values")));
+#if UNVERSIONED_PROPERTY_BULK_SERIALIZATION
+			// Saving with byte swapping would need a swapped copy of each run, just use the per-value path
+			if (GUnversionedPropertyBulkSerialization && !UnderlyingArchive.IsTextFormat() && !UnderlyingArchive.IsByteSwapping())
+			{
+				for (FUnversionedHeader::FIterator It(Header, Schema); It; )
+				{
+					const FUnversionedPropertySerializer* Serializer = It.GetSerializerPtr();
+					const uint32 Num = It.IsNonZero() ? It.GetUniformValueNum(Serializer->GetBulkNum()) : 0;
+					if (Num > 1)
+					{
+						FUnversionedPropertySerializer::SerializeBulk(ValueStream.EnterElement().GetUnderlyingArchive(), Serializer, Num, Data);
+						It.Advance(Num);
+					}
+					else
+					{
+						if (It.IsNonZero())
+						{
+							Serializer->Serialize(ValueStream.EnterElement(), Data, Defaults);
+						}
+						It.Next();
+					}
+				}
+			}
+			else
+#endif
 			for (FUnversionedHeader::FIterator It(Header, Schema); It; It.Next())
 			{
 				if (It.IsNonZero())
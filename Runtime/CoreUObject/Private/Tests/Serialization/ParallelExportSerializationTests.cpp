@@ -0,0 +1,101 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/Package.h"
+#include "UObject/ObjectRedirector.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+namespace ParallelExportSerializationTest
+{
+	#define TEST_NAME_ROOT "System.CoreUObject.Serialization.ParallelExportSerialization"
+	constexpr const uint32 TestFlags = EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter;
+
+	/** Overrides an integer console variable within a scope */
+	struct FScopedConsoleVariable
+	{
+		IConsoleVariable* Variable;
+		int32 OldValue;
+
+		FScopedConsoleVariable(const TCHAR* Name, int32 Value)
+			: Variable(IConsoleManager::Get().FindConsoleVariable(Name))
+			, OldValue(0)
+		{
+			check(Variable);
+			OldValue = Variable->GetInt();
+			Variable->Set(Value, ECVF_SetByCode);
+		}
+
+		~FScopedConsoleVariable()
+		{
+			Variable->Set(OldValue, ECVF_SetByCode);
+		}
+	};
+
+	/** Creates a package of redirectors referencing each other, so that all of its exports can be serialized concurrently */
+	static UPackage* CreateRedirectorPackage(int32 NumRedirectors, TArray<UObjectRedirector*>& OutRedirectors)
+	{
+		UPackage* Package = NewObject<UPackage>(nullptr, MakeUniqueObjectName(nullptr, UPackage::StaticClass(), TEXT("/Temp/ParallelExportSerializationTest")));
+		for (int32 Index = 0; Index < NumRedirectors; ++Index)
+		{
+			OutRedirectors.Add(NewObject<UObjectRedirector>(Package, NAME_None, RF_Public | RF_Standalone));
+		}
+		for (int32 Index = 0; Index < NumRedirectors; ++Index)
+		{
+			OutRedirectors[Index]->DestinationObject = OutRedirectors[(Index + 1) % NumRedirectors];
+		}
+		return Package;
+	}
+
+	static void DestroyRedirectorPackage(UPackage* Package, TArray<UObjectRedirector*>& Redirectors)
+	{
+		for (UObjectRedirector* Redirector : Redirectors)
+		{
+			Redirector->ClearFlags(RF_Standalone);
+			Redirector->MarkPendingKill();
+		}
+		Package->MarkPendingKill();
+	}
+
+	static bool SavePackageToBytes(UPackage* Package, const FString& Filename, TArray<uint8>& OutBytes)
+	{
+		const bool bSaved = UPackage::SavePackage(Package, nullptr, RF_Standalone, *Filename, GError, nullptr, false, true, SAVE_NoError | SAVE_KeepGUID);
+		const bool bRead = bSaved && FFileHelper::LoadFileToArray(OutBytes, *Filename);
+		IFileManager::Get().Delete(*Filename);
+		return bRead;
+	}
+
+	IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParallelExportSerializationTestSave, TEST_NAME_ROOT ".Save", TestFlags)
+	bool FParallelExportSerializationTestSave::RunTest(const FString& Parameters)
+	{
+		TArray<UObjectRedirector*> Redirectors;
+		UPackage* Package = CreateRedirectorPackage(32, Redirectors);
+		const FString Filename = FPaths::Combine(FPaths::AutomationTransientDir(), Package->GetName() + FPackageName::GetAssetPackageExtension());
+
+		TArray<uint8> SerialBytes;
+		TArray<uint8> ParallelBytes;
+		{
+			FScopedConsoleVariable ParallelExports(TEXT("SavePackage.ParallelExportSerialization"), 0);
+			TestTrue(TEXT("Saved the package serially"), SavePackageToBytes(Package, Filename, SerialBytes));
+		}
+		{
+			FScopedConsoleVariable ParallelExports(TEXT("SavePackage.ParallelExportSerialization"), 1);
+			FScopedConsoleVariable MinBatch(TEXT("SavePackage.ParallelExportSerializationMinBatch"), 2);
+			TestTrue(TEXT("Saved the package in parallel"), SavePackageToBytes(Package, Filename, ParallelBytes));
+		}
+
+		TestTrue(TEXT("Parallel and serial saves are byte identical"), SerialBytes.Num() > 0 && SerialBytes == ParallelBytes);
+
+		DestroyRedirectorPackage(Package, Redirectors);
+		return true;
+	}
+
+	#undef TEST_NAME_ROOT
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
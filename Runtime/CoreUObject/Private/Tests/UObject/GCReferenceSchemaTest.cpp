@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UObject/GarbageCollection.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && UE_GC_USE_REFERENCE_SCHEMA
+
+namespace GCReferenceSchemaTest
+{
+	static void AddReferencedObjects(UObject*, FReferenceCollector&)
+	{
+	}
+
+	static void AddStructReferencedObjects(void*, FReferenceCollector&)
+	{
+	}
+
+	static void EmitObject(FGCReferenceTokenStream& TokenStream, uint32 Offset)
+	{
+		static const FName TokenName("ObjectToken");
+		TokenStream.EmitReferenceInfo(FGCReferenceInfo(GCRT_Object, Offset), TokenName);
+	}
+
+	static void EmitAddReferencedObjects(FGCReferenceTokenStream& TokenStream)
+	{
+		static const FName TokenName("AROToken");
+		TokenStream.EmitReferenceInfo(FGCReferenceInfo(GCRT_AddReferencedObjects, 0), TokenName);
+		TokenStream.EmitPointer((const void*)&AddReferencedObjects);
+	}
+
+	static void EmitEndOfStream(FGCReferenceTokenStream& TokenStream)
+	{
+		static const FName TokenName("EndOfStreamToken");
+		TokenStream.EmitReferenceInfo(FGCReferenceInfo(GCRT_EndOfStream, 0), TokenName);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGCReferenceSchemaTest, "System.CoreUObject.GarbageCollection.ReferenceSchema", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FGCReferenceSchemaTest::RunTest(const FString& Parameters)
+{
+	using namespace GCReferenceSchemaTest;
+
+	{
+		// Object reference followed by the class AddReferencedObjects function, as emitted by Fixup
+		FGCReferenceTokenStream TokenStream;
+		EmitObject(TokenStream, 8);
+		EmitAddReferencedObjects(TokenStream);
+		EmitEndOfStream(TokenStream);
+
+		TestTrue(TEXT("Stream with AddReferencedObjects compiles"), TokenStream.CompileSchema());
+		const FGCReferenceSchema& Schema = TokenStream.GetSchema();
+		TestTrue(TEXT("Schema is compiled"), Schema.IsCompiled());
+		TestTrue(TEXT("AddReferencedObjects function"), Schema.AddReferencedObjects == &AddReferencedObjects);
+		TestEqual(TEXT("AddReferencedObjects token index"), Schema.AddReferencedObjectsTokenIndex, 1);
+		TestEqual(TEXT("Object references"), Schema.Blocks[0].Objects.Num(), 1);
+	}
+
+	{
+		// Array of structs ending with a native AddStructReferencedObjects call, so its return is stored in the end of pointer token
+		FGCReferenceTokenStream TokenStream;
+		static const FName ArrayTokenName("ArrayStructToken");
+		static const FName StructAROTokenName("StructAROToken");
+		TokenStream.EmitReferenceInfo(FGCReferenceInfo(GCRT_ArrayStruct, 16), ArrayTokenName);
+		TokenStream.EmitStride(24);
+		const uint32 SkipIndexIndex = TokenStream.EmitSkipIndexPlaceholder();
+		EmitObject(TokenStream, 0);
+		TokenStream.EmitReferenceInfo(FGCReferenceInfo(GCRT_AddStructReferencedObjects, 8), StructAROTokenName);
+		TokenStream.EmitPointer((const void*)&AddStructReferencedObjects);
+		TokenStream.UpdateSkipIndexPlaceholder(SkipIndexIndex, TokenStream.EmitReturn());
+		EmitObject(TokenStream, 48);
+		EmitAddReferencedObjects(TokenStream);
+		EmitEndOfStream(TokenStream);
+
+		TestTrue(TEXT("Stream with AddStructReferencedObjects compiles"), TokenStream.CompileSchema());
+		const FGCReferenceSchema& Schema = TokenStream.GetSchema();
+		if (TestEqual(TEXT("Blocks"), Schema.Blocks.Num(), 2))
+		{
+			TestEqual(TEXT("Object references after the array are back in the object block"), Schema.Blocks[0].Objects.Num(), 2);
+			TestEqual(TEXT("Struct arrays"), Schema.Blocks[0].StructArrays.Num(), 1);
+			TestEqual(TEXT("Struct element object references"), Schema.Blocks[1].Objects.Num(), 1);
+			if (TestEqual(TEXT("Struct AddStructReferencedObjects calls"), Schema.Blocks[1].StructReferencedObjectsCalls.Num(), 1))
+			{
+				TestEqual(TEXT("Struct AddStructReferencedObjects offset"), (int32)Schema.Blocks[1].StructReferencedObjectsCalls[0].Offset, 8);
+			}
+		}
+		TestTrue(TEXT("AddReferencedObjects function"), Schema.AddReferencedObjects == &AddReferencedObjects);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && UE_GC_USE_REFERENCE_SCHEMA
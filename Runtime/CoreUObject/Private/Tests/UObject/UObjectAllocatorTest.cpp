@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectAllocator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUObjectAllocatorTest, "System.CoreUObject.UObject.Allocator", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FUObjectAllocatorTest::RunTest(const FString& Parameters)
+{
+	// Sizes below, at and above the largest pooled size, including ones that are not a multiple of the alignment
+	const int32 Sizes[] = { 1, 16, 40, 56, 200, 1008, 1024, 1025, 4096 };
+	constexpr int32 NumPerSize = 2000;
+
+	// Pools are enabled on a local allocator so that they are tested even when objects don't use them, the slabs are
+	// shared with GUObjectAllocator if it has enabled them too
+	FUObjectAllocator Allocator;
+	Allocator.EnableSizeClassPools();
+	TestTrue(TEXT("Size class pools are enabled"), Allocator.UsesSizeClassPools());
+
+	int32 NumSlabsBefore, NumLiveBefore;
+	SIZE_T SlabBytesBefore;
+	Allocator.GetPoolStats(NumSlabsBefore, SlabBytesBefore, NumLiveBefore);
+
+	TArray<UObjectBase*> Allocations;
+	bool bAligned = true;
+	for (int32 Size : Sizes)
+	{
+		for (int32 Index = 0; Index < NumPerSize; ++Index)
+		{
+			UObjectBase* Object = Allocator.AllocateUObject(Size, 16, false);
+			bAligned &= IsAligned(Object, 16);
+			FMemory::Memset(Object, uint8(Allocations.Num()), Size);
+			Allocations.Add(Object);
+		}
+	}
+	TestTrue(TEXT("Objects are 16 byte aligned"), bAligned);
+
+	// Every allocation kept its own contents, so none of them overlap
+	bool bIntact = true;
+	int32 AllocationIndex = 0;
+	for (int32 Size : Sizes)
+	{
+		for (int32 Index = 0; Index < NumPerSize; ++Index, ++AllocationIndex)
+		{
+			const uint8* Bytes = (const uint8*)Allocations[AllocationIndex];
+			bIntact &= Bytes[0] == uint8(AllocationIndex) && Bytes[Size - 1] == uint8(AllocationIndex);
+		}
+	}
+	TestTrue(TEXT("Allocations don't overlap"), bIntact);
+
+	int32 NumSlabs, NumLive;
+	SIZE_T SlabBytes;
+	Allocator.GetPoolStats(NumSlabs, SlabBytes, NumLive);
+	TestTrue(TEXT("Small objects are allocated from slabs"), NumLive >= NumLiveBefore + 7 * NumPerSize && NumSlabs > NumSlabsBefore);
+
+	// Free every other object first so that freed slots get reused by the next round
+	for (int32 Index = 0; Index < Allocations.Num(); Index += 2)
+	{
+		Allocator.FreeUObject(Allocations[Index]);
+		Allocations[Index] = Allocator.AllocateUObject(40, 16, false);
+	}
+	for (UObjectBase* Object : Allocations)
+	{
+		Allocator.FreeUObject(Object);
+	}
+	Allocator.TrimPools();
+
+	Allocator.GetPoolStats(NumSlabs, SlabBytes, NumLive);
+	TestEqual(TEXT("Freed objects are returned to the slabs"), NumLive, NumLiveBefore);
+	TestTrue(TEXT("Empty slabs are released"), NumSlabs <= NumSlabsBefore);
+
+	// Objects allocated before the pools were enabled are freed with the default allocator
+	FUObjectAllocator LateAllocator;
+	UObjectBase* EarlyObject = LateAllocator.AllocateUObject(40, 16, false);
+	TestFalse(TEXT("Size class pools are disabled by default"), LateAllocator.UsesSizeClassPools());
+	LateAllocator.EnableSizeClassPools();
+	LateAllocator.FreeUObject(EarlyObject);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
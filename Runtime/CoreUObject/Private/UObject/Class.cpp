@@ -9,6 +9,7 @@
 #include "HAL/LowLevelMemTracker.h"
 #include "Misc/ScopeLock.h"
 #include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/OutputDeviceHelper.h"
 #include "Misc/FeedbackContext.h"
@@ -53,6 +54,10 @@
 #include "UObject/PropertyProxyArchive.h"
 #include "UObject/FieldPath.h"
 #include "HAL/ThreadSafeCounter.h"
+#include "HAL/IConsoleManager.h"
+#include "Templates/Atomic.h"
+#include "Templates/RefCounting.h"
+#include "Async/ParallelFor.h"
 
 
 // WARNING: This should always be the last include in any file that needs it (except .generated.h)
@@ -78,6 +83,8 @@ static_assert(sizeof(__underlying_type(EClassFlags)) == sizeof(uint32), "expecti
 
 //////////////////////////////////////////////////////////////////////////
 
+static void DestroyTaggedPropertyLoadPlans(const UStruct* Struct, bool bIncludeDerivedStructs);
+
 FThreadSafeBool& InternalSafeGetTokenStreamDirtyFlag()
 {
 	static FThreadSafeBool TokenStreamDirty(true);
@@ -768,6 +775,9 @@ void UStruct::CollectBytecodeAndPropertyReferencedObjects()
 
 void UStruct::Link(FArchive& Ar, bool bRelinkExistingProperties)
 {
+	// Plans of this and derived structs reference the properties being relinked
+	DestroyTaggedPropertyLoadPlans(this, true);
+
 	if (bRelinkExistingProperties)
 	{
 		// Preload everything before we calculate size, as the preload may end up recursively linking things
@@ -1277,6 +1287,368 @@ void UStruct::LoadTaggedPropertiesFromText(FStructuredArchive::FSlot Slot, uint8
 	}
 }
 
+/*-----------------------------------------------------------------------------
+	Tagged property load plans.
+-----------------------------------------------------------------------------*/
+
+static int32 GTaggedPropertyLoadPlansEnabled = 0;
+static FAutoConsoleVariableRef CVarTaggedPropertyLoadPlansEnabled(
+	TEXT("s.TaggedPropertyLoadPlans"),
+	GTaggedPropertyLoadPlansEnabled,
+	TEXT("If true, the resolution of property tags to properties is memoized per struct and tag sequence when loading tagged properties."),
+	ECVF_Default
+);
+
+static int32 GTaggedPropertyLoadPlanMaxSteps = 1024;
+static FAutoConsoleVariableRef CVarTaggedPropertyLoadPlanMaxSteps(
+	TEXT("s.TaggedPropertyLoadPlanMaxSteps"),
+	GTaggedPropertyLoadPlanMaxSteps,
+	TEXT("Maximum number of memoized property tag resolutions kept per struct."),
+	ECVF_Default
+);
+
+/** Archive state that affects how property tags resolve and which properties are skipped */
+struct FTaggedPropertyLoadPlanContext
+{
+	int32 UE4Ver;
+	int32 LicenseeUE4Ver;
+	uint32 PortFlags;
+	uint32 ArchiveFlags;
+
+	explicit FTaggedPropertyLoadPlanContext(const FArchive& Ar)
+		: UE4Ver(Ar.UE4Ver())
+		, LicenseeUE4Ver(Ar.LicenseeUE4Ver())
+		, PortFlags(Ar.GetPortFlags())
+		, ArchiveFlags(
+			(Ar.IsPersistent() ? 1 : 0) |
+			(Ar.IsSaveGame() ? 2 : 0) |
+			(Ar.IsFilterEditorOnly() ? 4 : 0) |
+			(Ar.IsTransacting() ? 8 : 0) |
+			(Ar.IsSerializingDefaults() ? 16 : 0) |
+			(Ar.WantBinaryPropertySerialization() ? 32 : 0) |
+			(GForceLoadEditorOnly ? 64 : 0))
+	{
+	}
+
+	bool operator==(const FTaggedPropertyLoadPlanContext& Other) const
+	{
+		return UE4Ver == Other.UE4Ver && LicenseeUE4Ver == Other.LicenseeUE4Ver && PortFlags == Other.PortFlags && ArchiveFlags == Other.ArchiveFlags;
+	}
+};
+
+/** The parts of a property tag that decide which property it resolves to and how it is loaded */
+struct FTaggedPropertyLoadPlanKey
+{
+	FName Type;
+	FName Name;
+	FName StructName;
+	FName EnumName;
+	FName InnerType;
+	FName ValueType;
+	int32 ArrayIndex = INDEX_NONE;
+	uint8 HasPropertyGuid = 0;
+	FGuid StructGuid;
+	FGuid PropertyGuid;
+
+	FTaggedPropertyLoadPlanKey() = default;
+
+	explicit FTaggedPropertyLoadPlanKey(const FPropertyTag& Tag)
+		: Type(Tag.Type)
+		, Name(Tag.Name)
+		, StructName(Tag.StructName)
+		, EnumName(Tag.EnumName)
+		, InnerType(Tag.InnerType)
+		, ValueType(Tag.ValueType)
+		, ArrayIndex(Tag.ArrayIndex)
+		, HasPropertyGuid(Tag.HasPropertyGuid)
+		, StructGuid(Tag.StructGuid)
+		, PropertyGuid(Tag.PropertyGuid)
+	{
+	}
+
+	FORCEINLINE bool Matches(const FPropertyTag& Tag) const
+	{
+		return Name == Tag.Name && Type == Tag.Type && ArrayIndex == Tag.ArrayIndex &&
+			StructName == Tag.StructName && EnumName == Tag.EnumName && InnerType == Tag.InnerType && ValueType == Tag.ValueType &&
+			StructGuid == Tag.StructGuid && HasPropertyGuid == Tag.HasPropertyGuid && (!HasPropertyGuid || PropertyGuid == Tag.PropertyGuid);
+	}
+
+	bool operator==(const FTaggedPropertyLoadPlanKey& Other) const
+	{
+		return Name == Other.Name && Type == Other.Type && ArrayIndex == Other.ArrayIndex &&
+			StructName == Other.StructName && EnumName == Other.EnumName && InnerType == Other.InnerType && ValueType == Other.ValueType &&
+			StructGuid == Other.StructGuid && HasPropertyGuid == Other.HasPropertyGuid && (!HasPropertyGuid || PropertyGuid == Other.PropertyGuid);
+	}
+};
+
+/**
+ * Memoized property tag resolutions of a struct. Steps form a tree per archive context, so every path from a root
+ * is the compiled plan of one tag sequence: instances saved with the same tag layout walk the same path and skip
+ * the property search, redirects and type checks for every tag. Steps are immutable once published and only
+ * added, so lookups don't take locks.
+ *
+ * Plans are reference counted. The struct holds one reference and every load that uses the plans holds another, so
+ * plans destroyed by a relink while another thread is loading stay alive until that load is done.
+ */
+struct FTaggedPropertyLoadPlans : public FThreadSafeRefCountedObject
+{
+	/** Tag sequences rarely diverge, a step that keeps branching stops being recorded to keep the sibling scan short */
+	static constexpr int32 MaxChildrenPerStep = 8;
+
+	struct FStep
+	{
+		FTaggedPropertyLoadPlanKey Key;
+		/** Property the tag resolved to */
+		FProperty* Property = nullptr;
+		/** Remaining array dim of the expected property after this tag */
+		int32 RemainingArrayDim = 0;
+		/** True if the tag is loaded with SerializeTaggedProperty, false if it is skipped */
+		bool bSerialize = false;
+		/** Number of children, only accessed under StepsCritical */
+		int32 NumChildren = 0;
+		/** Published after the child is fully initialized, loads synchronize with that store */
+		TAtomic<FStep*> FirstChild { nullptr };
+		FStep* NextSibling = nullptr;
+
+		FORCEINLINE const FStep* FindChild(const FPropertyTag& Tag) const
+		{
+			for (const FStep* Child = FirstChild.Load(); Child; Child = Child->NextSibling)
+			{
+				if (Child->Key.Matches(Tag))
+				{
+					return Child;
+				}
+			}
+			return nullptr;
+		}
+	};
+
+	struct FRoot
+	{
+		FTaggedPropertyLoadPlanContext Context;
+		FStep* Step;
+	};
+
+	FRWLock RootsLock;
+	TArray<FRoot> Roots;
+	FCriticalSection StepsCritical;
+	TArray<FStep*> AllSteps;
+
+	virtual ~FTaggedPropertyLoadPlans()
+	{
+		for (FStep* Step : AllSteps)
+		{
+			delete Step;
+		}
+		for (FRoot& Root : Roots)
+		{
+			delete Root.Step;
+		}
+	}
+
+	const FStep* FindOrAddRoot(const FTaggedPropertyLoadPlanContext& Context)
+	{
+		{
+			FRWScopeLock ReadLock(RootsLock, SLT_ReadOnly);
+			for (const FRoot& Root : Roots)
+			{
+				if (Root.Context == Context)
+				{
+					return Root.Step;
+				}
+			}
+		}
+		FRWScopeLock WriteLock(RootsLock, SLT_Write);
+		for (const FRoot& Root : Roots)
+		{
+			if (Root.Context == Context)
+			{
+				return Root.Step;
+			}
+		}
+		FRoot& NewRoot = Roots.Add_GetRef({ Context, new FStep() });
+		return NewRoot.Step;
+	}
+
+	/** Records how a tag following Parent resolved. Returns null once the step budget is exhausted. */
+	const FStep* AddStep(const FStep* Parent, const FTaggedPropertyLoadPlanKey& Key, FProperty* Property, int32 RemainingArrayDim, bool bSerialize)
+	{
+		FScopeLock StepsLock(&StepsCritical);
+
+		FStep* MutableParent = const_cast<FStep*>(Parent);
+		for (const FStep* Child = MutableParent->FirstChild.Load(); Child; Child = Child->NextSibling)
+		{
+			if (Child->Key == Key)
+			{
+				// Another thread recorded the same tag
+				return Child;
+			}
+		}
+		if (AllSteps.Num() >= GTaggedPropertyLoadPlanMaxSteps || MutableParent->NumChildren >= MaxChildrenPerStep)
+		{
+			return nullptr;
+		}
+
+		FStep* NewStep = new FStep();
+		NewStep->Key = Key;
+		NewStep->Property = Property;
+		NewStep->RemainingArrayDim = RemainingArrayDim;
+		NewStep->bSerialize = bSerialize;
+		NewStep->NextSibling = MutableParent->FirstChild.Load();
+		MutableParent->NumChildren++;
+		AllSteps.Add(NewStep);
+		// Publish the fully initialized step
+		MutableParent->FirstChild.Store(NewStep);
+		return NewStep;
+	}
+};
+
+/** Guards publishing and unpublishing UStruct::TaggedPropertyLoadPlans, so that a reference can't be taken to plans being destroyed */
+static FRWLock GTaggedPropertyLoadPlansLock;
+
+/** Super structs of structs with plans, the plans reference properties inherited from them */
+static FCriticalSection GTaggedPropertyLoadPlanSupersCritical;
+static TSet<const UStruct*> GTaggedPropertyLoadPlanSupers;
+
+/** Returns a reference to the plans of a struct, creating them if needed. The reference keeps them alive while they are in use. */
+static TRefCountPtr<FTaggedPropertyLoadPlans> AcquireTaggedPropertyLoadPlans(const UStruct* Struct)
+{
+	{
+		FRWScopeLock ReadLock(GTaggedPropertyLoadPlansLock, SLT_ReadOnly);
+		if (FTaggedPropertyLoadPlans* ExistingPlans = Struct->TaggedPropertyLoadPlans)
+		{
+			return TRefCountPtr<FTaggedPropertyLoadPlans>(ExistingPlans);
+		}
+	}
+
+	FRWScopeLock WriteLock(GTaggedPropertyLoadPlansLock, SLT_Write);
+	if (FTaggedPropertyLoadPlans* ExistingPlans = Struct->TaggedPropertyLoadPlans)
+	{
+		return TRefCountPtr<FTaggedPropertyLoadPlans>(ExistingPlans);
+	}
+
+	// The struct holds its own reference
+	FTaggedPropertyLoadPlans* CreatedPlans = new FTaggedPropertyLoadPlans();
+	CreatedPlans->AddRef();
+	Struct->TaggedPropertyLoadPlans = CreatedPlans;
+
+	if (const UStruct* SuperStruct = Struct->GetSuperStruct())
+	{
+		FScopeLock SupersLock(&GTaggedPropertyLoadPlanSupersCritical);
+		for (; SuperStruct; SuperStruct = SuperStruct->GetSuperStruct())
+		{
+			GTaggedPropertyLoadPlanSupers.Add(SuperStruct);
+		}
+	}
+
+	return TRefCountPtr<FTaggedPropertyLoadPlans>(CreatedPlans);
+}
+
+/**
+ * Unpublishes the plans of a struct and releases the reference the struct holds. Loads still using the plans keep
+ * them alive, and the plans are freed when the last of them is done.
+ *
+ * @param Struct The struct whose plans are destroyed
+ * @param bIncludeDerivedStructs Also destroy the plans of derived structs, needed when the inherited properties change
+ */
+static void DestroyTaggedPropertyLoadPlans(const UStruct* Struct, bool bIncludeDerivedStructs)
+{
+	bool bHasDerivedPlans;
+	{
+		FScopeLock SupersLock(&GTaggedPropertyLoadPlanSupersCritical);
+		bHasDerivedPlans = GTaggedPropertyLoadPlanSupers.Remove(Struct) > 0;
+	}
+
+	// Gather the structs before taking the plans lock, the object iterator takes the UObject hash tables lock
+	TArray<const UStruct*, TInlineAllocator<1>> Structs;
+	Structs.Add(Struct);
+	if (bHasDerivedPlans && bIncludeDerivedStructs)
+	{
+		for (TObjectIterator<UStruct> It; It; ++It)
+		{
+			if (*It != Struct && It->IsChildOf(Struct))
+			{
+				Structs.Add(*It);
+			}
+		}
+	}
+
+	TArray<FTaggedPropertyLoadPlans*, TInlineAllocator<1>> PlansToRelease;
+	{
+		FRWScopeLock WriteLock(GTaggedPropertyLoadPlansLock, SLT_Write);
+		for (const UStruct* DestroyStruct : Structs)
+		{
+			if (DestroyStruct->TaggedPropertyLoadPlans)
+			{
+				PlansToRelease.Add(DestroyStruct->TaggedPropertyLoadPlans);
+				DestroyStruct->TaggedPropertyLoadPlans = nullptr;
+			}
+		}
+	}
+
+	for (FTaggedPropertyLoadPlans* Plans : PlansToRelease)
+	{
+		Plans->Release();
+	}
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTaggedPropertyLoadPlansTest, "System.CoreUObject.Class.TaggedPropertyLoadPlans", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FTaggedPropertyLoadPlansTest::RunTest(const FString& Parameters)
+{
+	UScriptStruct* Struct = TBaseStructure<FFloatInterval>::Get();
+	TGuardValue<int32> EnablePlans(GTaggedPropertyLoadPlansEnabled, 1);
+
+	TArray<uint8> Bytes;
+	{
+		FFloatInterval Interval{ 1.5f, 2.5f };
+		FMemoryWriter Writer(Bytes, true);
+		Struct->SerializeTaggedProperties(Writer, (uint8*)&Interval, Struct, nullptr);
+	}
+	auto LoadInterval = [Struct, &Bytes]()
+	{
+		FFloatInterval Interval{ 0.0f, 0.0f };
+		FMemoryReader Reader(Bytes, true);
+		Struct->SerializeTaggedProperties(Reader, (uint8*)&Interval, Struct, nullptr);
+		return Interval.Min == 1.5f && Interval.Max == 2.5f;
+	};
+
+	// Record a plan, then hold a reference to it the way a load on another thread does while relinking the struct
+	TestTrue(TEXT("Load recording a plan"), LoadInterval());
+	TestTrue(TEXT("Load replaying a plan"), LoadInterval());
+	{
+		TRefCountPtr<FTaggedPropertyLoadPlans> PlansInUse = AcquireTaggedPropertyLoadPlans(Struct);
+		const FTaggedPropertyLoadPlans::FStep* Root = PlansInUse->FindOrAddRoot(FTaggedPropertyLoadPlanContext(FMemoryReader(Bytes, true)));
+		TestTrue(TEXT("Plan has recorded steps"), Root->FirstChild.Load() != nullptr);
+
+		Struct->StaticLink(true);
+		TestTrue(TEXT("Relinking unpublishes the plans"), Struct->TaggedPropertyLoadPlans != PlansInUse.GetReference());
+		TestEqual(TEXT("Plans in use are only referenced by their user after a relink"), (int32)PlansInUse->GetRefCount(), 1);
+		TestTrue(TEXT("Plans in use stay valid after a relink"), Root->FirstChild.Load() != nullptr && Root->FirstChild.Load()->Property != nullptr);
+	}
+	TestTrue(TEXT("Load after a relink"), LoadInterval());
+
+	// Loads on worker threads while plans are destroyed and recreated
+	TAtomic<int32> NumFailedLoads(0);
+	ParallelFor(256, [Struct, &LoadInterval, &NumFailedLoads](int32 Index)
+	{
+		if (Index % 8 == 0)
+		{
+			DestroyTaggedPropertyLoadPlans(Struct, true);
+		}
+		else if (!LoadInterval())
+		{
+			++NumFailedLoads;
+		}
+	});
+	TestEqual(TEXT("Loads while plans are destroyed"), NumFailedLoads.Load(), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
+
 void UStruct::SerializeTaggedProperties(FStructuredArchive::FSlot Slot, uint8* Data, UStruct* DefaultsStruct, uint8* Defaults, const UObject* BreakRecursionIfFullyLoad) const
 {
 	if (Slot.GetArchiveState().UseUnversionedPropertySerialization())
@@ -1318,6 +1690,20 @@ void UStruct::SerializeVersionedTaggedProperties(FStructuredArchive::FSlot Slot,
 		bool		bAdvanceProperty	= false;
 		int32		RemainingArrayDim	= Property ? Property->ArrayDim : 0;
 
+		// Instances saved with the same tag sequence resolve their tags identically, so the resolution is memoized
+		// per struct and replayed while the tags keep following a known sequence.
+		TRefCountPtr<FTaggedPropertyLoadPlans> Plans;
+		const FTaggedPropertyLoadPlans::FStep* PlanStep = nullptr;
+		if (GTaggedPropertyLoadPlansEnabled && UnderlyingArchive.IsPersistent()
+#if WITH_EDITOR
+			&& !(BreakRecursionIfFullyLoad && BreakRecursionIfFullyLoad->HasAllFlags(RF_LoadCompleted))
+#endif
+			)
+		{
+			Plans = AcquireTaggedPropertyLoadPlans(this);
+			PlanStep = Plans->FindOrAddRoot(FTaggedPropertyLoadPlanContext(UnderlyingArchive));
+		}
+
 		// Load all stored properties, potentially skipping unknown ones.
 		while (true)
 		{
@@ -1331,6 +1717,49 @@ void UStruct::SerializeVersionedTaggedProperties(FStructuredArchive::FSlot Slot,
 					break;
 				}
 
+				if (PlanStep)
+				{
+					if (const FTaggedPropertyLoadPlans::FStep* NextPlanStep = PlanStep->FindChild(Tag))
+					{
+						// Replay the memoized resolution of this tag
+						Property = NextPlanStep->Property;
+						RemainingArrayDim = NextPlanStep->RemainingArrayDim;
+						bAdvanceProperty = false;
+
+						const int64 StartOfProperty = UnderlyingArchive.Tell();
+						if (NextPlanStep->bSerialize)
+						{
+							FStructuredArchive::FSlot ValueSlot = PropertyRecord.EnterField(SA_FIELD_NAME(TEXT("Value")));
+							uint8* DestAddress = Property->ContainerPtrToValuePtr<uint8>(Data, Tag.ArrayIndex);
+							uint8* DefaultsFromParent = Property->ContainerPtrToValuePtrForDefaults<uint8>(DefaultsStruct, Defaults, Tag.ArrayIndex);
+							Tag.SerializeTaggedProperty(ValueSlot, Property, DestAddress, DefaultsFromParent);
+							bAdvanceProperty = !UnderlyingArchive.IsCriticalError();
+						}
+
+						if (!bAdvanceProperty)
+						{
+							UnderlyingArchive.Seek(StartOfProperty + Tag.Size);
+						}
+						else
+						{
+							check(Tag.Size == UnderlyingArchive.Tell() - StartOfProperty);
+						}
+
+						// A failed load leaves the sequence, resolve the remaining tags the regular way
+						PlanStep = (NextPlanStep->bSerialize && !bAdvanceProperty) ? nullptr : NextPlanStep;
+						continue;
+					}
+				}
+
+				// Resolution of this tag, recorded in the plan if it only depends on the tag and the struct
+				enum class EPlanAction : uint8 { Uncacheable, Skip, Serialize };
+				EPlanAction PlanAction = EPlanAction::Uncacheable;
+				FTaggedPropertyLoadPlanKey PlanKey;
+				if (PlanStep)
+				{
+					PlanKey = FTaggedPropertyLoadPlanKey(Tag);
+				}
+
 				// Move to the next property to be serialized
 				if (bAdvanceProperty && --RemainingArrayDim <= 0)
 				{
@@ -1408,7 +1837,11 @@ void UStruct::SerializeVersionedTaggedProperties(FStructuredArchive::FSlot Slot,
 					Property = CustomFindProperty(Tag.Name);
 				}
 
-				if (Property)
+				if (!Property)
+				{
+					PlanAction = EPlanAction::Skip;
+				}
+				else
 				{
 					FName PropID = Property->GetID();
 
@@ -1445,6 +1878,7 @@ void UStruct::SerializeVersionedTaggedProperties(FStructuredArchive::FSlot Slot,
 					// the editor but are cooking for console (editoronly implies notforconsole)
 					if ((Property->PropertyFlags & CPF_EditorOnly) && !FPlatformProperties::HasEditorOnlyData() && !GForceLoadEditorOnly)
 					{
+						PlanAction = EPlanAction::Skip;
 					}
 					// check for valid array index
 					else if (Tag.ArrayIndex >= Property->ArrayDim || Tag.ArrayIndex < 0)
@@ -1454,12 +1888,17 @@ void UStruct::SerializeVersionedTaggedProperties(FStructuredArchive::FSlot Slot,
 					}
 					else if (!Property->ShouldSerializeValue(UnderlyingArchive))
 					{
+						if (!FPlatformProperties::RequiresCookedData())
+						{
+							PlanAction = EPlanAction::Skip;
+						}
 						UE_CLOG((UnderlyingArchive.IsPersistent() && FPlatformProperties::RequiresCookedData()), LogClass, Warning, TEXT("Skipping saved property %s of %s since it is no longer serializable for asset:  %s. (Maybe resave asset?)"), *Tag.Name.ToString(), *GetName(), *UnderlyingArchive.GetArchiveName());
 					}
 					else
 					{
 						FStructuredArchive::FSlot ValueSlot = PropertyRecord.EnterField(SA_FIELD_NAME(TEXT("Value")));
 
+						const int64 StartOfValue = UnderlyingArchive.Tell();
 						switch (Property->ConvertFromType(Tag, ValueSlot, Data, DefaultsStruct))
 						{
 							case EConvertFromTypeResult::Converted:
@@ -1476,9 +1915,16 @@ void UStruct::SerializeVersionedTaggedProperties(FStructuredArchive::FSlot Slot,
 									uint8* DestAddress = Property->ContainerPtrToValuePtr<uint8>(Data, Tag.ArrayIndex);
 									uint8* DefaultsFromParent = Property->ContainerPtrToValuePtrForDefaults<uint8>(DefaultsStruct, Defaults, Tag.ArrayIndex);
 
+									// ConvertFromType only decided to use SerializeItem if it didn't read anything
+									const bool bConvertFromTypeConsumedData = UnderlyingArchive.Tell() != StartOfValue;
+
 									// This property is ok.
 									Tag.SerializeTaggedProperty(ValueSlot, Property, DestAddress, DefaultsFromParent);
 									bAdvanceProperty = !UnderlyingArchive.IsCriticalError();
+									if (bAdvanceProperty && !bConvertFromTypeConsumedData)
+									{
+										PlanAction = EPlanAction::Serialize;
+									}
 								}
 								break;
 
@@ -1501,6 +1947,13 @@ void UStruct::SerializeVersionedTaggedProperties(FStructuredArchive::FSlot Slot,
 				{
 					check(Tag.Size == Loaded);
 				}
+
+				if (PlanStep)
+				{
+					PlanStep = PlanAction != EPlanAction::Uncacheable
+						? Plans->AddStep(PlanStep, PlanKey, Property, RemainingArrayDim, PlanAction == EPlanAction::Serialize)
+						: nullptr;
+				}
 			}
 		}
 	}
@@ -1625,6 +2078,7 @@ void UStruct::SerializeVersionedTaggedProperties(FStructuredArchive::FSlot Slot,
 void UStruct::FinishDestroy()
 {
 	DestroyUnversionedSchema(this);
+	DestroyTaggedPropertyLoadPlans(this, false);
 	Script.Empty();
 	Super::FinishDestroy();
 }
@@ -4752,6 +5206,7 @@ void UClass::PurgeClass(bool bRecompilingOnLoad)
 #endif // WITH_EDITORONLY_DATA
 
 	DestroyUnversionedSchema(this);
+	DestroyTaggedPropertyLoadPlans(this, true);
 }
 
 #if WITH_EDITORONLY_DATA
@@ -13,6 +13,7 @@
 #include "Misc/PackageName.h"
 #include "Misc/ScopeRWLock.h"
 #include "Serialization/DeferredMessageLog.h"
+#include "Templates/Atomic.h"
 #include "Templates/Casts.h"
 
 #if !defined UE_WITH_CORE_REDIRECTS
@@ -437,6 +438,136 @@ FCoreRedirectObjectName FCoreRedirect::RedirectName(const FCoreRedirectObjectNam
 	return ModifyName;
 }
 
+/**
+ * Cache of redirect lookups that matched nothing. Almost every query, e.g. for each import of each loaded package, finds no redirect,
+ * answering repeated ones from the cache avoids probing the map of every redirect type and checking all substring redirects again.
+ *
+ * Redirects only match queries with exactly the same category bits, so the cache is partitioned by category and a change to the
+ * registered redirects only invalidates the partition of its category. Adding known missing (Category_Removed) redirects during
+ * loading therefore doesn't flush the cached misses of regular lookups. Each partition is split into shards with their own lock so
+ * that recording misses from several loading threads doesn't serialize on a single write lock.
+ */
+class FCoreRedirectsMissCache
+{
+public:
+	/** Returns the generation to pass to Add for a lookup started now */
+	uint32 GetGeneration(ECoreRedirectFlags SearchFlags) const
+	{
+		return GetPartition(SearchFlags).Generation.Load();
+	}
+
+	bool Contains(ECoreRedirectFlags SearchFlags, const FCoreRedirectObjectName& ObjectName)
+	{
+		const FKey Key(SearchFlags, ObjectName);
+		const uint32 KeyHash = GetTypeHash(Key);
+		FShard& Shard = GetPartition(SearchFlags).GetShard(KeyHash);
+
+		FRWScopeLock ScopeLock(Shard.Lock, FRWScopeLockType::SLT_ReadOnly);
+		return Shard.Misses.ContainsByHash(KeyHash, Key);
+	}
+
+	/** Records a miss, unless redirects of the same category changed since the lookup started */
+	void Add(uint32 LookupGeneration, ECoreRedirectFlags SearchFlags, const FCoreRedirectObjectName& ObjectName)
+	{
+		const FKey Key(SearchFlags, ObjectName);
+		const uint32 KeyHash = GetTypeHash(Key);
+		FPartition& Partition = GetPartition(SearchFlags);
+		FShard& Shard = Partition.GetShard(KeyHash);
+
+		FRWScopeLock ScopeLock(Shard.Lock, FRWScopeLockType::SLT_Write);
+		// Checked under the shard lock, Invalidate changes the generation before it empties the shards
+		if (LookupGeneration == Partition.Generation.Load() && Shard.Misses.Num() < MaxMissesPerShard)
+		{
+			Shard.Misses.AddByHash(KeyHash, Key);
+		}
+	}
+
+	/** Forgets the misses that redirects with the given flags could match */
+	void Invalidate(ECoreRedirectFlags RedirectFlags)
+	{
+		GetPartition(RedirectFlags).Invalidate();
+	}
+
+	void InvalidateAll()
+	{
+		for (FPartition& Partition : Partitions)
+		{
+			Partition.Invalidate();
+		}
+	}
+
+private:
+	static constexpr int32 NumPartitions = 4;
+	static constexpr int32 NumShards = 8;
+	static constexpr int32 MaxMissesPerShard = 64 * 1024 / (NumPartitions * NumShards);
+
+	struct FKey
+	{
+		FKey(ECoreRedirectFlags InSearchFlags, const FCoreRedirectObjectName& InObjectName)
+			: SearchFlags(InSearchFlags)
+			, ObjectName(InObjectName)
+		{
+		}
+
+		ECoreRedirectFlags SearchFlags;
+		FCoreRedirectObjectName ObjectName;
+
+		bool operator==(const FKey& Other) const
+		{
+			return SearchFlags == Other.SearchFlags && ObjectName == Other.ObjectName;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			uint32 Hash = HashCombine(GetTypeHash(Key.ObjectName.ObjectName), GetTypeHash(Key.ObjectName.OuterName));
+			Hash = HashCombine(Hash, GetTypeHash(Key.ObjectName.PackageName));
+			return HashCombine(Hash, uint32(Key.SearchFlags));
+		}
+	};
+
+	struct FShard
+	{
+		FRWLock Lock;
+		TSet<FKey> Misses;
+	};
+
+	struct FPartition
+	{
+		TAtomic<uint32> Generation { 0 };
+		FShard Shards[NumShards];
+
+		FORCEINLINE FShard& GetShard(uint32 KeyHash)
+		{
+			// The low bits pick the TSet bucket, use the high bits for the shard
+			return Shards[(KeyHash >> 24) % NumShards];
+		}
+
+		void Invalidate()
+		{
+			++Generation;
+			for (FShard& Shard : Shards)
+			{
+				FRWScopeLock ScopeLock(Shard.Lock, FRWScopeLockType::SLT_Write);
+				Shard.Misses.Reset();
+			}
+		}
+	};
+
+	/** Categories must match exactly, so misses of one category can only be affected by redirects of the same category */
+	FORCEINLINE FPartition& GetPartition(ECoreRedirectFlags Flags)
+	{
+		return Partitions[(uint32(Flags & ECoreRedirectFlags::Category_AllMask) >> 16) % NumPartitions];
+	}
+	FORCEINLINE const FPartition& GetPartition(ECoreRedirectFlags Flags) const
+	{
+		return const_cast<FCoreRedirectsMissCache*>(this)->GetPartition(Flags);
+	}
+
+	FPartition Partitions[NumPartitions];
+};
+
+static FCoreRedirectsMissCache GCoreRedirectsMissCache;
+
 bool FCoreRedirects::bInitialized = false;
 #if WITH_COREREDIRECTS_MULTITHREAD_WARNING
 bool FCoreRedirects::bIsInMultithreadedPhase = false;
@@ -566,6 +697,12 @@ const TMap<FString, FString>* FCoreRedirects::GetValueRedirects(ECoreRedirectFla
 
 bool FCoreRedirects::GetMatchingRedirects(ECoreRedirectFlags SearchFlags, const FCoreRedirectObjectName& OldObjectName, TArray<const FCoreRedirect*>& FoundRedirects)
 {
+	const uint32 MissCacheGeneration = GCoreRedirectsMissCache.GetGeneration(SearchFlags);
+	if (GCoreRedirectsMissCache.Contains(SearchFlags, OldObjectName))
+	{
+		return false;
+	}
+
 	// Look for all redirects that match the given names and flags
 	bool bFound = false;
 	
@@ -596,6 +733,11 @@ bool FCoreRedirects::GetMatchingRedirects(ECoreRedirectFlags SearchFlags, const
 		}
 	}
 
+	if (!bFound)
+	{
+		GCoreRedirectsMissCache.Add(MissCacheGeneration, SearchFlags, OldObjectName);
+	}
+
 	return bFound;
 }
 
@@ -680,6 +822,7 @@ void FCoreRedirects::ClearKnownMissing(ECoreRedirectFlags Type, ECoreRedirectFla
 	if (RedirectNameMap)
 	{
 		RedirectNameMap->RedirectMap.Empty();
+		GCoreRedirectsMissCache.Invalidate(RedirectFlags);
 	}
 }
 
@@ -692,6 +835,7 @@ bool FCoreRedirects::RunTests()
 	bIsInMultithreadedPhase = false;
 #endif
 	RedirectTypeMap.Empty();
+	GCoreRedirectsMissCache.InvalidateAll();
 
 	TArray<FCoreRedirect> NewRedirects;
 
@@ -831,8 +975,34 @@ bool FCoreRedirects::RunTests()
 		UE_LOG(LogLinker, Error, TEXT("FCoreRedirect Test Failed: /Game/NotRemovedPackage should no longer be removed!"));
 	}
 
+	// Misses are cached, registering a redirect has to make it visible to lookups that previously found nothing
+	const FCoreRedirectObjectName LateClassName(TEXT("/Game/PackageOther.LateClass"));
+	if (GetRedirectedName(ECoreRedirectFlags::Type_Class, LateClassName) != LateClassName)
+	{
+		bSuccess = false;
+		UE_LOG(LogLinker, Error, TEXT("FCoreRedirect Test Failed: /Game/PackageOther.LateClass should not be redirected yet!"));
+	}
+
+	// Known missing redirects have their own category and must not flush the misses of regular lookups
+	AddKnownMissing(ECoreRedirectFlags::Type_Package, FCoreRedirectObjectName(TEXT("/Game/LateRemovedPackage")), ECoreRedirectFlags::Option_MissingLoad);
+	if (!GCoreRedirectsMissCache.Contains(ECoreRedirectFlags::Type_Class, LateClassName))
+	{
+		bSuccess = false;
+		UE_LOG(LogLinker, Error, TEXT("FCoreRedirect Test Failed: adding a known missing package should not invalidate cached class lookups!"));
+	}
+
+	FCoreRedirect LateClassRedirect(ECoreRedirectFlags::Type_Class, TEXT("LateClass"), TEXT("LateClass2"));
+	AddRedirectList(TArrayView<const FCoreRedirect>(&LateClassRedirect, 1), TEXT("RunTests"));
+
+	if (GetRedirectedName(ECoreRedirectFlags::Type_Class, LateClassName).ToString() != TEXT("/Game/PackageOther.LateClass2"))
+	{
+		bSuccess = false;
+		UE_LOG(LogLinker, Error, TEXT("FCoreRedirect Test Failed: /Game/PackageOther.LateClass should be redirected after adding a redirect!"));
+	}
+
 	// Restore old state
 	RedirectTypeMap = BackupMap;
+	GCoreRedirectsMissCache.InvalidateAll();
 #if WITH_COREREDIRECTS_MULTITHREAD_WARNING
 	bIsInMultithreadedPhase = BackupIsInMultithreadedPhase;
 #endif
@@ -1037,6 +1207,7 @@ bool FCoreRedirects::AddSingleRedirect(const FCoreRedirect& NewRedirect, const F
 	}
 
 	ExistingRedirects.Add(NewRedirect);
+	GCoreRedirectsMissCache.Invalidate(NewRedirect.RedirectFlags);
 	return true;
 }
 
@@ -1108,6 +1279,7 @@ bool FCoreRedirects::RemoveSingleRedirect(const FCoreRedirect& RedirectToRemove,
 
 			bRemovedRedirect = true;
 			ExistingRedirects->RemoveAt(ExistingRedirectIndex);
+			GCoreRedirectsMissCache.Invalidate(RedirectToRemove.RedirectFlags);
 			break;
 		}
 	}
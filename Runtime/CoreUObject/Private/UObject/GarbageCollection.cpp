@@ -189,6 +189,16 @@ static FAutoConsoleVariableRef CMultithreadedDestructionEnabled(
 	ECVF_Default
 );
 
+#if UE_GC_USE_REFERENCE_SCHEMA
+int32 GUseGCReferenceSchema = 1;
+static FAutoConsoleVariableRef CVarUseGCReferenceSchema(
+	TEXT("gc.UseReferenceSchema"),
+	GUseGCReferenceSchema,
+	TEXT("If true, reachability analysis will use reference schemas precompiled from class token streams instead of interpreting the token streams."),
+	ECVF_Default
+);
+#endif // UE_GC_USE_REFERENCE_SCHEMA
+
 #if PERF_DETAILED_PER_CLASS_GC_STATS
 /** Map from a UClass' FName to the number of objects that were purged during the last purge phase of this class.	*/
 static TMap<const FName,uint32> GClassToPurgeCountMap;
@@ -1493,6 +1503,11 @@ void IncrementalPurgeGarbage(bool bUseTimeLimit, float TimeLimit)
 		if (!bTimeLimitReached)
 		{
 			bCompleted = IncrementalDestroyGarbage(bUseTimeLimit, TimeLimit);
+			if (bCompleted)
+			{
+				// Release object slabs emptied by this purge
+				GUObjectAllocator.TrimPools();
+			}
 		}
 	}
 #endif // !UE_WITH_GC
@@ -2157,6 +2172,9 @@ void CollectGarbage(EObjectFlags KeepFlags, bool bPerformFullPurge)
 	// Other threads are free to use UObjects
 	// GC执行完毕，释放线程锁
 	ReleaseGCLock();
+
+	// Look for new clusters outside of the GC lock, they are used from the next collection on
+	TickAutomaticClustering();
 }
 
 bool TryCollectGarbage(EObjectFlags KeepFlags, bool bPerformFullPurge)
@@ -2181,6 +2199,9 @@ bool TryCollectGarbage(EObjectFlags KeepFlags, bool bPerformFullPurge)
 
 		// Other threads are free to use UObjects
 		ReleaseGCLock();
+
+		// Look for new clusters outside of the GC lock, they are used from the next collection on
+		TickAutomaticClustering();
 	}
 	else
 	{
@@ -2752,6 +2773,10 @@ void UClass::AssembleReferenceTokenStream(bool bForce)
 		static const FName EOSDebugName("EndOfStreamToken");
 		EmitObjectReference(0, EOSDebugName, GCRT_EndOfStream);
 
+#if UE_GC_USE_REFERENCE_SCHEMA
+		ReferenceTokenStream.CompileSchema();
+#endif // UE_GC_USE_REFERENCE_SCHEMA
+
 		// Shrink reference token stream to proper size.
 		ReferenceTokenStream.Shrink();
 
@@ -3057,6 +3082,158 @@ FTokenInfo FGCReferenceTokenStream::GetTokenInfo(int32 TokenIndex) const
 #endif
 
 
+#if UE_GC_USE_REFERENCE_SCHEMA
+
+void FGCReferenceSchema::Shrink()
+{
+	Blocks.Shrink();
+	for (FBlock& Block : Blocks)
+	{
+		Block.Objects.Shrink();
+		Block.PersistentObjects.Shrink();
+		Block.NoopObjects.Shrink();
+		Block.NoopPersistentObjects.Shrink();
+		Block.ObjectArrays.Shrink();
+		Block.StructArrays.Shrink();
+		Block.StructReferencedObjectsCalls.Shrink();
+	}
+}
+
+bool FGCReferenceTokenStream::CompileSchema()
+{
+	Schema.Reset();
+	Schema.Blocks.AddDefaulted();
+
+	uint32 TokenIndex = 0;
+	uint32 ReturnCount = 0;
+	if (!CompileSchemaBlock(TokenIndex, 0, ReturnCount))
+	{
+		// Leave this stream to the token stream interpreter
+		Schema.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool FGCReferenceTokenStream::ReadEndOfPointer(uint32& TokenIndex, uint32& OutReturnCount)
+{
+	if (EndOfStream(TokenIndex))
+	{
+		return false;
+	}
+	// EmitPointer always follows the pointer with this token and EmitReturn stores the return count of the pointer owner in it
+	const FGCReferenceInfo EndOfPointer = AccessReferenceInfo(TokenIndex++);
+	OutReturnCount = EndOfPointer.ReturnCount;
+	return EndOfPointer.Type == GCRT_EndOfPointer;
+}
+
+bool FGCReferenceTokenStream::CompileSchemaBlock(uint32& TokenIndex, int32 BlockIndex, uint32& OutReturnCount)
+{
+	while (!EndOfStream(TokenIndex))
+	{
+		const uint32 ReferenceTokenIndex = TokenIndex++;
+		const FGCReferenceInfo ReferenceInfo = AccessReferenceInfo(ReferenceTokenIndex);
+		uint32 ReturnCount = ReferenceInfo.ReturnCount;
+
+		switch (ReferenceInfo.Type)
+		{
+		case GCRT_Object:
+		case GCRT_Class:
+			Schema.Blocks[BlockIndex].Objects.Add(ReferenceInfo.Offset, ReferenceTokenIndex);
+			break;
+		case GCRT_PersistentObject:
+			Schema.Blocks[BlockIndex].PersistentObjects.Add(ReferenceInfo.Offset, ReferenceTokenIndex);
+			break;
+		case GCRT_NoopClass:
+			Schema.Blocks[BlockIndex].NoopObjects.Add(ReferenceInfo.Offset, ReferenceTokenIndex);
+			break;
+		case GCRT_NoopPersistentObject:
+			Schema.Blocks[BlockIndex].NoopPersistentObjects.Add(ReferenceInfo.Offset, ReferenceTokenIndex);
+			break;
+		case GCRT_ArrayObject:
+			Schema.Blocks[BlockIndex].ObjectArrays.Add(ReferenceInfo.Offset, ReferenceTokenIndex);
+			break;
+		case GCRT_ArrayStruct:
+		case GCRT_FixedArray:
+			{
+				FGCReferenceSchema::FStructArray StructArray;
+				StructArray.Offset = ReferenceInfo.Offset;
+				StructArray.Stride = ReadStride(TokenIndex);
+				if (ReferenceInfo.Type == GCRT_FixedArray)
+				{
+					StructArray.FixedCount = ReadCount(TokenIndex);
+				}
+				else
+				{
+					// Empty arrays are handled by the element loop so the skip info is not needed
+					ReadSkipInfo(TokenIndex);
+					StructArray.FixedCount = 0;
+				}
+				StructArray.BlockIndex = Schema.Blocks.AddDefaulted();
+
+				uint32 InnerReturnCount = 0;
+				if (!CompileSchemaBlock(TokenIndex, StructArray.BlockIndex, InnerReturnCount) || InnerReturnCount == 0)
+				{
+					return false;
+				}
+				Schema.Blocks[BlockIndex].StructArrays.Add(StructArray);
+				// The last token of the array also returns from this array's level
+				ReturnCount = InnerReturnCount - 1;
+			}
+			break;
+		case GCRT_AddStructReferencedObjects:
+			{
+				FGCReferenceSchema::FStructReferencedObjectsCall Call;
+				Call.Offset = ReferenceInfo.Offset;
+				Call.Func = (FGCReferenceSchema::FAddStructReferencedObjectsFunc)ReadPointer(TokenIndex);
+				if (!ReadEndOfPointer(TokenIndex, ReturnCount))
+				{
+					return false;
+				}
+				Schema.Blocks[BlockIndex].StructReferencedObjectsCalls.Add(Call);
+			}
+			break;
+		case GCRT_AddReferencedObjects:
+			if (BlockIndex != 0 || Schema.AddReferencedObjects)
+			{
+				return false;
+			}
+			Schema.AddReferencedObjects = (FGCReferenceSchema::FAddReferencedObjectsFunc)ReadPointer(TokenIndex);
+			Schema.AddReferencedObjectsTokenIndex = (int32)ReferenceTokenIndex;
+			if (!ReadEndOfPointer(TokenIndex, ReturnCount))
+			{
+				return false;
+			}
+			break;
+		case GCRT_ExternalPackage:
+			if (BlockIndex != 0 || Schema.ExternalPackageTokenIndex != INDEX_NONE)
+			{
+				return false;
+			}
+			Schema.ExternalPackageTokenIndex = (int32)ReferenceTokenIndex;
+			break;
+		case GCRT_EndOfStream:
+			OutReturnCount = 0;
+			return BlockIndex == 0;
+		default:
+			// Weak, lazy, soft, delegate, field path and container tokens are rare enough to not be worth compiling
+			return false;
+		}
+
+		if (ReturnCount > 0)
+		{
+			OutReturnCount = ReturnCount;
+			// Nothing can be returned from at the object level
+			return BlockIndex != 0;
+		}
+	}
+
+	OutReturnCount = 0;
+	return false;
+}
+
+#endif // UE_GC_USE_REFERENCE_SCHEMA
+
 FGCArrayPool* FGCArrayPool::GetGlobalSingleton()
 {
 	static FAutoConsoleCommandWithOutputDevice GCDumpPoolCommand(
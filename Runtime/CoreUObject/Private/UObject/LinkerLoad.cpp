@@ -1590,6 +1590,7 @@ FLinkerLoad::ELinkerStatus FLinkerLoad::SerializeImportMap()
 	if(ImportMapIndex == 0 && Summary.ImportCount > 0 )
 	{
 		Seek( Summary.ImportOffset );
+		ImportMap.Reserve(Summary.ImportCount);
 	}
 
 	FStructuredArchive::FStream Stream = StructuredArchiveRootRecord->EnterStream(SA_FIELD_NAME(TEXT("ImportTable")));
@@ -1870,6 +1871,7 @@ FLinkerLoad::ELinkerStatus FLinkerLoad::SerializeExportMap()
 	if(ExportMapIndex == 0 && Summary.ExportCount > 0)
 	{
 		Seek( Summary.ExportOffset );
+		ExportMap.Reserve(Summary.ExportCount);
 	}
 
 	FStructuredArchive::FStream Stream = StructuredArchiveRootRecord->EnterStream(SA_FIELD_NAME(TEXT("ExportTable")));
@@ -2294,11 +2296,13 @@ FLinkerLoad::ELinkerStatus FLinkerLoad::CreateExportHash()
 		return LINKER_Loaded;
 	}
 
-	// Initialize hash on first iteration.
+	// Initialize hash on first iteration, with about one bucket per export so large packages keep short chains.
 	if( ExportHashIndex == 0 )
 	{
-		ExportHash.Reset(new int32[ExportHashCount]);
-		for( int32 i=0; i<ExportHashCount; i++ )
+		const int32 NumBuckets = FMath::Max<int32>(ExportHashCount, FMath::RoundUpToPowerOfTwo(ExportMap.Num()));
+		ExportHashMask = NumBuckets - 1;
+		ExportHash.Reset(new int32[NumBuckets]);
+		for( int32 i=0; i<NumBuckets; i++ )
 		{
 			ExportHash[i] = INDEX_NONE;
 		}
@@ -2309,7 +2313,7 @@ FLinkerLoad::ELinkerStatus FLinkerLoad::CreateExportHash()
 	{
 		FObjectExport& Export = ExportMap[ExportHashIndex];
 
-		const int32 iHash = HashNames( Export.ObjectName, GetExportClassName(ExportHashIndex), GetExportClassPackage(ExportHashIndex) ) & (ExportHashCount-1);
+		const int32 iHash = HashNames( Export.ObjectName, GetExportClassName(ExportHashIndex), GetExportClassPackage(ExportHashIndex) ) & ExportHashMask;
 		Export.HashNext = ExportHash[iHash];
 		ExportHash[iHash] = ExportHashIndex;
 
@@ -3200,7 +3204,7 @@ bool FLinkerLoad::VerifyImportInner(const int32 ImportIndex, FString& WarningSuf
 			Pkg = Import.SourceLinker->LinkerRoot;
 
 			// Find this import within its existing linker.
-			int32 iHash = HashNames( Import.ObjectName, Import.ClassName, Import.ClassPackage) & (ExportHashCount-1);
+			int32 iHash = HashNames( Import.ObjectName, Import.ClassName, Import.ClassPackage) & Import.SourceLinker->ExportHashMask;
 
 			//@Package name transition, if we can match without shortening the names, then we must not take a shortened match
 			bool bMatchesWithoutShortening = false;
@@ -3613,6 +3617,9 @@ void FLinkerLoad::LoadAllObjects(bool bForcePreload)
 	// Tick the heartbeat if we're loading on the game thread
 	const bool bShouldTickHeartBeat = IsInGameThread();
 
+	// Objects created for the exports take their object indices from a single reservation
+	FScopedUObjectIndexReservation ObjectIndexReservation(ExportMap.Num());
+
 	for(int32 ExportIndex = 0; ExportIndex < ExportMap.Num(); ++ExportIndex)
 	{
 #if WITH_EDITOR
@@ -3691,7 +3698,7 @@ FName FLinkerLoad::ResolveResourceName( FPackageIndex ResourceIndex )
 // Find the index of a specified object without regard to specific package.
 int32 FLinkerLoad::FindExportIndex( FName ClassName, FName ClassPackage, FName ObjectName, FPackageIndex ExportOuterIndex )
 {
-	int32 iHash = HashNames( ObjectName, ClassName, ClassPackage ) & (ExportHashCount-1);
+	int32 iHash = HashNames( ObjectName, ClassName, ClassPackage ) & ExportHashMask;
 
 	for( int32 i=ExportHash[iHash]; i!=INDEX_NONE; i=ExportMap[i].HashNext )
 	{
@@ -173,6 +173,23 @@ FLinkerSave::FLinkerSave(UPackage* InParent, bool bForceByteSwapping, bool bInSa
 	}
 }
 
+FLinkerSave::FLinkerSave(FLinkerSave* InParentLinker, FPackageIndex InExport)
+:	FLinker(ELinkerType::Save, InParentLinker->LinkerRoot, TEXT("$$Memory$$"))
+,	Saver(nullptr)
+,	ParentLinker(InParentLinker)
+{
+	check(!InParentLinker->ParentLinker);
+	check(InExport.IsExport());
+
+	Saver = new FLargeMemoryWriter(0, /* bIsPersistent */ true, *InParentLinker->GetArchiveName());
+
+	// Save with the exact versions, flags and cooking target of the package linker
+	FArchive::operator=(*InParentLinker);
+	SetFilterEditorOnly(InParentLinker->IsFilterEditorOnly());
+
+	CurrentlySavingExport = InExport;
+}
+
 bool FLinkerSave::CloseAndDestroySaver()
 {
 	bool bSuccess = true;
@@ -194,6 +211,11 @@ FLinkerSave::~FLinkerSave()
 
 int32 FLinkerSave::MapName(FNameEntryId Id) const
 {
+	if (ParentLinker)
+	{
+		return ParentLinker->MapName(Id);
+	}
+
 	const int32* IndexPtr = NameIndices.Find(Id);
 
 	if (IndexPtr)
@@ -206,9 +228,12 @@ int32 FLinkerSave::MapName(FNameEntryId Id) const
 
 FPackageIndex FLinkerSave::MapObject( const UObject* Object ) const
 {
+	// Export linkers only track the export being saved, everything else lives in the package linker
+	const FLinkerSave& MapsLinker = ParentLinker ? *ParentLinker : *this;
+
 	if (Object)
 	{
-		const FPackageIndex *Found = ObjectIndicesMap.Find(Object);
+		const FPackageIndex *Found = MapsLinker.ObjectIndicesMap.Find(Object);
 		if (Found)
 		{
 			if (IsEventDrivenLoaderEnabledInCookedBuilds() &&
@@ -216,14 +241,14 @@ FPackageIndex FLinkerSave::MapObject( const UObject* Object ) const
 				Object->GetOutermost()->GetFName() != GLongCoreUObjectPackageName && // We assume nothing in coreuobject ever loads assets in a constructor
 				*Found != CurrentlySavingExport) // would be weird, but I can't be a dependency on myself
 			{
-				const FObjectExport& SavingExport = Exp(CurrentlySavingExport);
+				const FObjectExport& SavingExport = MapsLinker.Exp(CurrentlySavingExport);
 				bool bFoundDep = false;
 				if (SavingExport.FirstExportDependency >= 0)
 				{
 					int32 NumDeps = SavingExport.CreateBeforeCreateDependencies + SavingExport.CreateBeforeSerializationDependencies + SavingExport.SerializationBeforeCreateDependencies + SavingExport.SerializationBeforeSerializationDependencies;
 					for (int32 DepIndex = SavingExport.FirstExportDependency; DepIndex < SavingExport.FirstExportDependency + NumDeps; DepIndex++)
 					{
-						if (DepListForErrorChecking[DepIndex] == *Found)
+						if (MapsLinker.DepListForErrorChecking[DepIndex] == *Found)
 						{
 							bFoundDep = true;
 						}
@@ -240,7 +265,7 @@ FPackageIndex FLinkerSave::MapObject( const UObject* Object ) const
 				{
 					UE_LOG(LogLinker, Fatal, TEXT("Attempt to map an object during save that was not listed as a dependency. Saving Export %d %s in %s. Missing Dep on %s %s."),
 						CurrentlySavingExport.ForDebugging(), *SavingExport.ObjectName.ToString(), *GetArchiveName(),
-						Found->IsExport() ? TEXT("Export") : TEXT("Import"), *ImpExp(*Found).ObjectName.ToString()
+						Found->IsExport() ? TEXT("Export") : TEXT("Import"), *MapsLinker.ImpExp(*Found).ObjectName.ToString()
 						);
 				}
 			}
@@ -326,6 +351,12 @@ void FLinkerSave::UsingCustomVersion(const struct FGuid& Guid)
 {
 	FArchiveUObject::UsingCustomVersion(Guid);
 
+	// Export linkers hand their custom versions over to the package linker, which reports late additions
+	if (ParentLinker)
+	{
+		return;
+	}
+
 	// Here we're going to try and dump the callstack that added a new custom version after package summary has been serialized
 	if (Summary.GetCustomVersionContainer().GetVersion(Guid) == nullptr)
 	{
@@ -4169,12 +4169,38 @@ FSavePackageResultStruct UPackage::Save(UPackage* InOuter, UObject* Base, EObjec
 
 					// Save exports.
 					int32 LastExportSaveStep = 0;
+					const bool bParallelExports = SavePackageUtilities::CanSerializeExportsInParallel(Linker.Get(), bTextFormat, bDiffing);
 					for( int32 i=0; i<Linker->ExportMap.Num(); i++ )
 					{
 						if ( EndSavingIfCancelled() )
 						{ 
 							return ESavePackageResult::Canceled;
 						}
+
+						// Save runs of thread safe exports concurrently
+						const int32 ParallelBatchEnd = bParallelExports ? SavePackageUtilities::FindParallelExportBatchEnd(Linker.Get(), i) : INDEX_NONE;
+						if (ParallelBatchEnd != INDEX_NONE)
+						{
+							ExportScope.EnterProgressFrame(ParallelBatchEnd - i);
+							SavePackageUtilities::SerializeExportsInParallel(Linker.Get(), i, ParallelBatchEnd, ExportsRecord, [&](FObjectExport& Export)
+							{
+#if WITH_EDITOR
+								if (bIsCooking)
+								{
+									Export.Object->CookAdditionalFiles(Filename, TargetPlatform,
+										[&AdditionalFilesFromExports](const TCHAR* Filename, void* Data, int64 Size)
+									{
+										FLargeMemoryWriter& Writer = AdditionalFilesFromExports.Emplace_GetRef(0, true, Filename);
+										Writer.Serialize(Data, Size);
+									});
+								}
+#endif
+								Export.Object->Mark(OBJECTMARK_Saved);
+							});
+							i = ParallelBatchEnd - 1;
+							continue;
+						}
+
 						ExportScope.EnterProgressFrame();
 
 						FObjectExport& Export = Linker->ExportMap[i];
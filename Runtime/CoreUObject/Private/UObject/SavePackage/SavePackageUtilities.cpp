@@ -2,9 +2,11 @@
 
 #include "UObject/SavePackage/SavePackageUtilities.h"
 
+#include "Async/ParallelFor.h"
 #include "Blueprint/BlueprintSupport.h"
 #include "CoreMinimal.h"
 #include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "Interfaces/ITargetPlatform.h"
 #include "Misc/AssetRegistryInterface.h"
 #include "Misc/ConfigCacheIni.h"
@@ -13,6 +15,8 @@
 #include "Misc/ScopedSlowTask.h"
 #include "Serialization/BulkData.h"
 #include "Serialization/BulkDataManifest.h"
+#include "Serialization/ArchiveUObjectFromStructuredArchive.h"
+#include "Serialization/Formatters/BinaryArchiveFormatter.h"
 #include "Serialization/LargeMemoryWriter.h"
 #include "UObject/AsyncWorkSequence.h"
 #include "UObject/Class.h"
@@ -164,6 +168,30 @@ void FArchiveObjectCrc32NonEditorProperties::Serialize(void* Data, int64 Length)
 
 static FThreadSafeCounter OutstandingAsyncWrites;
 
+static int32 GSavePackageParallelExportSerialization = 0;
+static FAutoConsoleVariableRef CVarSavePackageParallelExportSerialization(
+	TEXT("SavePackage.ParallelExportSerialization"),
+	GSavePackageParallelExportSerialization,
+	TEXT("Serialize runs of exports whose objects report IsSerializeThreadSafe() concurrently into separate buffers"),
+	ECVF_Default
+);
+
+static int32 GSavePackageParallelExportSerializationMinBatch = 4;
+static FAutoConsoleVariableRef CVarSavePackageParallelExportSerializationMinBatch(
+	TEXT("SavePackage.ParallelExportSerializationMinBatch"),
+	GSavePackageParallelExportSerializationMinBatch,
+	TEXT("Minimum number of consecutive thread safe exports to serialize concurrently"),
+	ECVF_Default
+);
+
+static int32 GSavePackageParallelBulkDataCompression = 1;
+static FAutoConsoleVariableRef CVarSavePackageParallelBulkDataCompression(
+	TEXT("SavePackage.ParallelBulkDataCompression"),
+	GSavePackageParallelBulkDataCompression,
+	TEXT("Compress the bulk data payloads appended to a package concurrently"),
+	ECVF_Default
+);
+
 namespace SavePackageUtilities
 {
 const FName NAME_World("World");
@@ -1331,6 +1359,69 @@ void SaveThumbnails(UPackage* InOuter, FLinkerSave* Linker, FStructuredArchive::
 #endif
 }
 
+/**
+ * Serializes compressed bulk data payloads concurrently into memory writers indexed like BulkDataToAppend.
+ * Leaves OutPayloads empty or entries null for payloads that must be serialized by the caller.
+ */
+static void CompressBulkDataInParallel(TArray<FLinkerSave::FBulkDataStorageInfo>& BulkDataToAppend, uint32 ExtraBulkDataFlags, bool bForceByteSwapping, TArray<TUniquePtr<FLargeMemoryWriter>>& OutPayloads)
+{
+	// Payloads duplicated into optional storage are serialized once per entry with different flags, leave them to the caller
+	TMap<FUntypedBulkData*, int32> EntryCounts;
+	for (const FLinkerSave::FBulkDataStorageInfo& BulkDataStorageInfo : BulkDataToAppend)
+	{
+		++EntryCounts.FindOrAdd(BulkDataStorageInfo.BulkData);
+	}
+
+	TArray<int32> EntryIndices;
+	for (int32 Index = 0; Index < BulkDataToAppend.Num(); ++Index)
+	{
+		const FLinkerSave::FBulkDataStorageInfo& BulkDataStorageInfo = BulkDataToAppend[Index];
+		if ((BulkDataStorageInfo.BulkDataFlags & BULKDATA_SerializeCompressed) && EntryCounts.FindChecked(BulkDataStorageInfo.BulkData) == 1)
+		{
+			EntryIndices.Add(Index);
+		}
+	}
+
+	if (EntryIndices.Num() < 2)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPackage_Save_CompressBulkDataInParallel);
+
+	// Set the flags the payloads are saved with and make sure they're loaded before going wide
+	TArray<uint32> OldBulkDataFlags;
+	TArray<void*> Payloads;
+	OldBulkDataFlags.SetNumUninitialized(EntryIndices.Num());
+	Payloads.SetNumUninitialized(EntryIndices.Num());
+	for (int32 Idx = 0; Idx < EntryIndices.Num(); ++Idx)
+	{
+		const FLinkerSave::FBulkDataStorageInfo& BulkDataStorageInfo = BulkDataToAppend[EntryIndices[Idx]];
+		OldBulkDataFlags[Idx] = BulkDataStorageInfo.BulkData->GetBulkDataFlags();
+		BulkDataStorageInfo.BulkData->ClearBulkDataFlags(0xFFFFFFFF);
+		BulkDataStorageInfo.BulkData->SetBulkDataFlags(BulkDataStorageInfo.BulkDataFlags | ExtraBulkDataFlags);
+		Payloads[Idx] = const_cast<void*>(BulkDataStorageInfo.BulkData->LockReadOnly());
+	}
+
+	OutPayloads.SetNum(BulkDataToAppend.Num());
+	ParallelFor(EntryIndices.Num(), [&BulkDataToAppend, &EntryIndices, &Payloads, &OutPayloads, bForceByteSwapping](int32 Idx)
+	{
+		const int32 EntryIndex = EntryIndices[Idx];
+		TUniquePtr<FLargeMemoryWriter> Writer = MakeUnique<FLargeMemoryWriter>(0, /* bIsPersistent */ true);
+		Writer->SetByteSwapping(bForceByteSwapping);
+		BulkDataToAppend[EntryIndex].BulkData->SerializeBulkData(*Writer, Payloads[Idx]);
+		OutPayloads[EntryIndex] = MoveTemp(Writer);
+	});
+
+	for (int32 Idx = 0; Idx < EntryIndices.Num(); ++Idx)
+	{
+		FUntypedBulkData* BulkData = BulkDataToAppend[EntryIndices[Idx]].BulkData;
+		BulkData->Unlock();
+		BulkData->ClearBulkDataFlags(0xFFFFFFFF);
+		BulkData->SetBulkDataFlags(OldBulkDataFlags[Idx]);
+	}
+}
+
 void SaveBulkData(FLinkerSave* Linker, const UPackage* InOuter, const TCHAR* Filename, const ITargetPlatform* TargetPlatform,
 				  FSavePackageContext* SavePackageContext, const bool bTextFormat, const bool bDiffing, const bool bComputeHash, TAsyncWorkSequence<FMD5>& AsyncWriteAndHashSequence, int64& TotalPackageSizeUncompressed)
 {
@@ -1411,9 +1502,18 @@ void SaveBulkData(FLinkerSave* Linker, const UPackage* InOuter, const TCHAR* Fil
 			BulkDataAlignment = TargetPlatform->GetMemoryMappingAlignment();
 		}
 
+		// Separate bulk data archives never byte swap, the linker might
+		TArray<TUniquePtr<FLargeMemoryWriter>> CompressedPayloads;
+		if (GSavePackageParallelBulkDataCompression)
+		{
+			CompressBulkDataInParallel(Linker->BulkDataToAppend, ExtraBulkDataFlags, !bShouldUseSeparateBulkFile && Linker->ForceByteSwapping(), CompressedPayloads);
+		}
+
 		uint16 BulkDataIndex = 1;
-		for (FLinkerSave::FBulkDataStorageInfo& BulkDataStorageInfo : Linker->BulkDataToAppend)
+		for (int32 BulkDataStorageIndex = 0; BulkDataStorageIndex < Linker->BulkDataToAppend.Num(); ++BulkDataStorageIndex)
 		{
+			FLinkerSave::FBulkDataStorageInfo& BulkDataStorageInfo = Linker->BulkDataToAppend[BulkDataStorageIndex];
+			FLargeMemoryWriter* CompressedPayload = CompressedPayloads.Num() > 0 ? CompressedPayloads[BulkDataStorageIndex].Get() : nullptr;
 			BulkDataFeedback.EnterProgressFrame();
 
 			// Set bulk data flags to what they were during initial serialization (they might have changed after that)
@@ -1489,7 +1589,14 @@ void SaveBulkData(FLinkerSave* Linker, const UPackage* InOuter, const TCHAR* Fil
 
 			int64 StoredBulkStartOffset = (ModifiedBulkDataFlags & BULKDATA_NoOffsetFixUp) == 0 ? BulkStartOffset - StartOfBulkDataArea : BulkStartOffset;
 
-			BulkDataStorageInfo.BulkData->SerializeBulkData(*TargetArchive, BulkDataStorageInfo.BulkData->Lock(LOCK_READ_ONLY));
+			if (CompressedPayload)
+			{
+				TargetArchive->Serialize(CompressedPayload->GetData(), CompressedPayload->TotalSize());
+			}
+			else
+			{
+				BulkDataStorageInfo.BulkData->SerializeBulkData(*TargetArchive, BulkDataStorageInfo.BulkData->Lock(LOCK_READ_ONLY));
+			}
 
 			int64 BulkEndOffset = TargetArchive->Tell();
 			const int64 LinkerEndOffset = Linker->Tell();
@@ -1546,7 +1653,10 @@ void SaveBulkData(FLinkerSave* Linker, const UPackage* InOuter, const TCHAR* Fil
 			// Restore BulkData flags to before serialization started
 			BulkDataStorageInfo.BulkData->ClearBulkDataFlags(0xFFFFFFFF);
 			BulkDataStorageInfo.BulkData->SetBulkDataFlags(OldBulkDataFlags);
-			BulkDataStorageInfo.BulkData->Unlock();
+			if (!CompressedPayload)
+			{
+				BulkDataStorageInfo.BulkData->Unlock();
+			}
 		}
 
 		if (BulkArchive)
@@ -1627,6 +1737,124 @@ void SaveWorldLevelInfo(UPackage* InOuter, FLinkerSave* Linker, FStructuredArchi
 	}
 }
 
+static bool CanSerializeExportInParallel(const FObjectExport& Export)
+{
+	return Export.Object && !Export.Object->HasAnyFlags(RF_ClassDefaultObject) && Export.Object->IsSerializeThreadSafe();
+}
+
+bool CanSerializeExportsInParallel(FLinkerSave* Linker, const bool bTextFormat, const bool bDiffing)
+{
+	// Diffing tracks callstacks per offset of the package archive and script SHA generation expects sequential writes
+	return GSavePackageParallelExportSerialization && !bTextFormat && !bDiffing && !Linker->ScriptSHA;
+}
+
+int32 FindParallelExportBatchEnd(FLinkerSave* Linker, int32 ExportIndex)
+{
+	int32 EndIndex = ExportIndex;
+	while (EndIndex < Linker->ExportMap.Num() && CanSerializeExportInParallel(Linker->ExportMap[EndIndex]))
+	{
+		++EndIndex;
+	}
+
+	return EndIndex - ExportIndex >= FMath::Max(GSavePackageParallelExportSerializationMinBatch, 2) ? EndIndex : INDEX_NONE;
+}
+
+void SerializeExportsInParallel(FLinkerSave* Linker, int32 BeginIndex, int32 EndIndex, FStructuredArchive::FRecord ExportsRecord, TFunctionRef<void(FObjectExport&)> OnExportSaved)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPackage_Save_SaveExportsInParallel);
+
+	const int32 Num = EndIndex - BeginIndex;
+	check(Num > 0);
+
+	TArray<TUniquePtr<FLinkerSave>, TInlineAllocator<64>> ExportLinkers;
+	ExportLinkers.Reserve(Num);
+	for (int32 Index = BeginIndex; Index < EndIndex; ++Index)
+	{
+		check(CanSerializeExportInParallel(Linker->ExportMap[Index]));
+		ExportLinkers.Emplace(new FLinkerSave(Linker, FPackageIndex::FromExport(Index)));
+	}
+
+	ParallelFor(Num, [Linker, BeginIndex, &ExportLinkers](int32 Offset)
+	{
+		FObjectExport& Export = Linker->ExportMap[BeginIndex + Offset];
+		FLinkerSave& ExportLinker = *ExportLinkers[Offset];
+
+		FUObjectSerializeContext* SerializeContext = FUObjectThreadContext::Get().GetSerializeContext();
+		TGuardValue<UObject*> GuardSerializedObject(SerializeContext->SerializedObject, Export.Object);
+		ExportLinker.SetSerializeContext(SerializeContext);
+
+		// Serialize through a structured archive the same way the sequential path does, so the bytes are identical
+		FBinaryArchiveFormatter Formatter(ExportLinker);
+		FStructuredArchive StructuredArchive(Formatter);
+		FStructuredArchive::FSlot ExportSlot = StructuredArchive.Open();
+#if WITH_EDITOR
+		const bool bSupportsText = UClass::IsSafeToSerializeToStructuredArchives(Export.Object->GetClass());
+#else
+		const bool bSupportsText = false;
+#endif
+		if (bSupportsText)
+		{
+			FStructuredArchive::FRecord ExportRecord = ExportSlot.EnterRecord();
+			Export.Object->Serialize(ExportRecord);
+		}
+		else
+		{
+			FArchiveUObjectFromStructuredArchive Adapter(ExportSlot);
+			Export.Object->Serialize(Adapter.GetArchive());
+			Adapter.Close();
+		}
+		StructuredArchive.Close();
+
+		ExportLinker.SetSerializeContext(nullptr);
+	});
+
+	// Append in export order so the result is identical to a sequential save
+	for (int32 Offset = 0; Offset < Num; ++Offset)
+	{
+		FObjectExport& Export = Linker->ExportMap[BeginIndex + Offset];
+		FLinkerSave& ExportLinker = *ExportLinkers[Offset];
+		FLargeMemoryWriter& ExportWriter = static_cast<FLargeMemoryWriter&>(*ExportLinker.Saver);
+
+		// Enter the same export slot as the sequential path, the binary formatter writes the data as is
+		FStructuredArchive::FSlot ExportSlot = ExportsRecord.EnterField(SA_FIELD_NAME(*Export.Object->GetPathName(Linker->LinkerRoot)));
+		FArchiveUObjectFromStructuredArchive Adapter(ExportSlot);
+		Export.SerialOffset = Linker->Tell();
+		Export.SerialSize = ExportWriter.TotalSize();
+		Adapter.GetArchive().Serialize(ExportWriter.GetData(), Export.SerialSize);
+		Adapter.Close();
+
+		for (FLinkerSave::FBulkDataStorageInfo BulkDataStorageInfo : ExportLinker.BulkDataToAppend)
+		{
+			BulkDataStorageInfo.BulkDataOffsetInFilePos += Export.SerialOffset;
+			BulkDataStorageInfo.BulkDataSizeOnDiskPos += Export.SerialOffset;
+			BulkDataStorageInfo.BulkDataFlagsPos += Export.SerialOffset;
+			Linker->BulkDataToAppend.Add(BulkDataStorageInfo);
+		}
+
+		for (const FCustomVersion& CustomVersion : ExportLinker.GetCustomVersions().GetAllVersions())
+		{
+			if (!Linker->GetCustomVersions().GetVersion(CustomVersion.Key))
+			{
+				Linker->UsingCustomVersion(CustomVersion.Key);
+			}
+		}
+
+		if (ExportLinker.RequiresLocalizationGather())
+		{
+			Linker->ThisRequiresLocalizationGather();
+		}
+
+		if (ExportLinker.IsError())
+		{
+			UE_LOG(LogSavePackage, Error, TEXT("Error serializing export %s into %s"), *Export.Object->GetFullName(), *Linker->GetArchiveName());
+			Linker->SetError();
+		}
+
+		ExportLinkers[Offset].Reset();
+		OnExportSaved(Export);
+	}
+}
+
 } // end namespace SavePackageUtilities
 
 void UPackage::WaitForAsyncFileWrites()
@@ -10,13 +10,16 @@
 #include "Serialization/ArchiveObjectCrc32.h"
 #include "Serialization/ArchiveStackTrace.h"
 #include "Serialization/FileRegions.h"
+#include "Templates/Function.h"
 #include "UObject/NameTypes.h"
 #include "UObject/UObjectMarks.h"
 
 // This file contains private utilities shared by UPackage::Save and UPackage::Save2 
 
+class FLinkerSave;
 class FMD5;
 class FSavePackageContext;
+struct FObjectExport;
 template<typename StateType> class TAsyncWorkSequence;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSavePackage, Log, All);
@@ -205,6 +208,20 @@ namespace SavePackageUtilities
 	void SaveBulkData(FLinkerSave* Linker, const UPackage* InOuter, const TCHAR* Filename, const ITargetPlatform* TargetPlatform,
 		FSavePackageContext* SavePackageContext, const bool bTextFormat, const bool bDiffing, const bool bComputeHash, TAsyncWorkSequence<FMD5>& AsyncWriteAndHashSequence, int64& TotalPackageSizeUncompressed);
 	void SaveWorldLevelInfo(UPackage* InOuter, FLinkerSave* Linker, FStructuredArchive::FRecord Record);
+
+	/** Whether some exports of this package can be serialized concurrently, see SerializeExportsInParallel */
+	bool CanSerializeExportsInParallel(FLinkerSave* Linker, const bool bTextFormat, const bool bDiffing);
+	/**
+	 * Returns the end of the run of consecutive exports starting at ExportIndex that can be serialized concurrently,
+	 * or INDEX_NONE if the run is too short to be worth it.
+	 */
+	int32 FindParallelExportBatchEnd(FLinkerSave* Linker, int32 ExportIndex);
+	/**
+	 * Serializes exports [BeginIndex, EndIndex) concurrently, each into its own export linker buffer, then appends
+	 * the buffers to Linker in export order through their ExportsRecord fields and fixes up export offsets and bulk
+	 * data positions. OnExportSaved is called on the calling thread for each export in order once its data has been appended.
+	 */
+	void SerializeExportsInParallel(FLinkerSave* Linker, int32 BeginIndex, int32 EndIndex, FStructuredArchive::FRecord ExportsRecord, TFunctionRef<void(FObjectExport&)> OnExportSaved);
 	EObjectMark GetExcludedObjectMarksForTargetPlatform(const class ITargetPlatform* TargetPlatform);
 	bool HasUnsaveableOuter(UObject* InObj, UPackage* InSavingPackage);
 	void CheckObjectPriorToSave(FArchiveUObject& Ar, UObject* InObj, UPackage* InSavingPackage);
@@ -1485,12 +1485,37 @@ ESavePackageResult WriteExports(FStructuredArchive::FRecord& StructuredArchiveRo
 
 	// Save exports.
 	int32 LastExportSaveStep = 0;
+	const bool bParallelExports = SavePackageUtilities::CanSerializeExportsInParallel(Linker, SaveContext.IsTextFormat(), SaveContext.IsDiffing());
 	for (int32 i = 0; i < Linker->ExportMap.Num(); i++)
 	{
 		if (GWarn->ReceivedUserCancel())
 		{
 			return ESavePackageResult::Canceled;
 		}
+
+		// Save runs of thread safe exports concurrently
+		const int32 ParallelBatchEnd = bParallelExports ? SavePackageUtilities::FindParallelExportBatchEnd(Linker, i) : INDEX_NONE;
+		if (ParallelBatchEnd != INDEX_NONE)
+		{
+			SlowTask.EnterProgressFrame(ParallelBatchEnd - i);
+			SavePackageUtilities::SerializeExportsInParallel(Linker, i, ParallelBatchEnd, [&SaveContext, Linker](FObjectExport& Export)
+			{
+#if WITH_EDITOR
+				if (Linker->IsCooking())
+				{
+					Export.Object->CookAdditionalFiles(SaveContext.GetFilename(), SaveContext.GetTargetPlatform(),
+						[&SaveContext](const TCHAR* Filename, void* Data, int64 Size)
+						{
+							FLargeMemoryWriter& Writer = SaveContext.AdditionalFilesFromExports.Emplace_GetRef(0, true, Filename);
+							Writer.Serialize(Data, Size);
+						});
+				}
+#endif
+			});
+			i = ParallelBatchEnd - 1;
+			continue;
+		}
+
 		SlowTask.EnterProgressFrame();
 
 		FObjectExport& Export = Linker->ExportMap[i];
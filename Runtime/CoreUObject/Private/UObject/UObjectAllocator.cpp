@@ -6,12 +6,249 @@
 
 #include "UObject/UObjectAllocator.h"
 #include "UObject/UObjectGlobals.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/PlatformMemory.h"
+#include "Stats/Stats.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUObjectAllocator, Log, All);
 
 /** Global UObjectBase allocator							*/
 COREUOBJECT_API FUObjectAllocator GUObjectAllocator;
 
+DECLARE_MEMORY_STAT(TEXT("UObject Slabs"), STAT_UObjectSlabMemory, STATGROUP_Memory);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("UObjects in Slabs"), STAT_UObjectSlabLiveObjects, STATGROUP_Object);
+
+namespace UObjectSizeClassPools
+{
+	/** Size of a single slab. Slabs are aligned to their size so the owning slab can be found from an object address. */
+	static constexpr SIZE_T SlabSize = 64 * 1024;
+	/** Address range reserved up front for all slabs. Objects that don't fit are allocated with FMemory::Malloc. */
+	static constexpr SIZE_T MaxSlabMemory = 1024 * 1024 * 1024;
+	/** Size class granularity, matches the forced object alignment */
+	static constexpr int32 SizeClassGranularity = 16;
+	/** Largest object served from slabs, bigger objects are allocated with FMemory::Malloc */
+	static constexpr int32 MaxPooledObjectSize = 1024;
+	static constexpr int32 NumSizeClasses = MaxPooledObjectSize / SizeClassGranularity;
+
+	/** Header placed at the start of each slab, objects follow it */
+	struct FSlab
+	{
+		/** Links in the owning size class list of slabs with free space */
+		FSlab* PrevSlab;
+		FSlab* NextSlab;
+		/** Singly linked list of freed objects, the link is stored in the freed memory */
+		void* FreeList;
+		/** Index of the owning size class */
+		int32 SizeClassIndex;
+		/** Number of objects currently allocated from this slab */
+		int32 NumLive;
+		/** Number of objects carved from the never used tail of this slab */
+		int32 NumCarved;
+		/** Maximum number of objects this slab can hold */
+		int32 Capacity;
+
+		FORCEINLINE uint8* GetObjects()
+		{
+			return (uint8*)this + Align(sizeof(FSlab), SizeClassGranularity);
+		}
+	};
+
+	struct FSizeClass
+	{
+		FCriticalSection Mutex;
+		/** Slabs with at least one free slot, most recently freed into first */
+		FSlab* PartialSlabs = nullptr;
+		int32 NumSlabs = 0;
+		int32 NumLive = 0;
+	};
+
+	struct FPools
+	{
+		FSizeClass SizeClasses[NumSizeClasses];
+
+		/** All slabs live in this reserved address range, so telling pooled objects apart from FMemory allocated ones is a range check */
+		FPlatformMemory::FPlatformVirtualMemoryBlock VirtualBlock;
+		UPTRINT RangeBegin = 0;
+		UPTRINT RangeSize = 0;
+
+		/** Guards the slab bookkeeping below, only taken when a slab is committed or released */
+		FCriticalSection SlabsMutex;
+		/** Number of slabs handed out from the start of the range so far */
+		int32 NumUsedSlabs = 0;
+		/** Decommitted slabs below NumUsedSlabs that can be committed again */
+		TArray<int32> FreeSlabIndices;
+
+		FPools()
+		{
+			VirtualBlock = FPlatformMemory::FPlatformVirtualMemoryBlock::AllocateVirtual(MaxSlabMemory, SlabSize);
+			RangeBegin = (UPTRINT)VirtualBlock.GetVirtualPointer();
+			RangeSize = RangeBegin ? MaxSlabMemory : 0;
+		}
+
+		/** Reserves the address range on first use, only called when pools are enabled so that it is never reserved otherwise */
+		static FPools& Get()
+		{
+			static FPools Singleton;
+			return Singleton;
+		}
+
+		static FORCEINLINE int32 GetElementSize(int32 SizeClassIndex)
+		{
+			return (SizeClassIndex + 1) * SizeClassGranularity;
+		}
+
+		FORCEINLINE bool Owns(const void* Object) const
+		{
+			return (UPTRINT)Object - RangeBegin < RangeSize;
+		}
+
+		static void LinkSlab(FSizeClass& SizeClass, FSlab* Slab)
+		{
+			Slab->PrevSlab = nullptr;
+			Slab->NextSlab = SizeClass.PartialSlabs;
+			if (SizeClass.PartialSlabs)
+			{
+				SizeClass.PartialSlabs->PrevSlab = Slab;
+			}
+			SizeClass.PartialSlabs = Slab;
+		}
+
+		static void UnlinkSlab(FSizeClass& SizeClass, FSlab* Slab)
+		{
+			if (Slab->PrevSlab)
+			{
+				Slab->PrevSlab->NextSlab = Slab->NextSlab;
+			}
+			else
+			{
+				SizeClass.PartialSlabs = Slab->NextSlab;
+			}
+			if (Slab->NextSlab)
+			{
+				Slab->NextSlab->PrevSlab = Slab->PrevSlab;
+			}
+			Slab->PrevSlab = Slab->NextSlab = nullptr;
+		}
+
+		/** Commits a slab in the reserved range, returns null if the range is used up */
+		FSlab* CommitSlab()
+		{
+			FScopeLock SlabsLock(&SlabsMutex);
+			int32 SlabIndex;
+			if (FreeSlabIndices.Num())
+			{
+				SlabIndex = FreeSlabIndices.Pop(false);
+			}
+			else if (SIZE_T(NumUsedSlabs + 1) * SlabSize <= RangeSize)
+			{
+				SlabIndex = NumUsedSlabs++;
+			}
+			else
+			{
+				return nullptr;
+			}
+			VirtualBlock.Commit(SIZE_T(SlabIndex) * SlabSize, SlabSize);
+			return (FSlab*)(RangeBegin + SIZE_T(SlabIndex) * SlabSize);
+		}
+
+		void DecommitSlab(FSlab* Slab)
+		{
+			const int32 SlabIndex = (int32)(((UPTRINT)Slab - RangeBegin) / SlabSize);
+			FScopeLock SlabsLock(&SlabsMutex);
+			VirtualBlock.Decommit(SIZE_T(SlabIndex) * SlabSize, SlabSize);
+			FreeSlabIndices.Add(SlabIndex);
+		}
+
+		/** Allocates from the size class of AlignedSize, returns null if no slab could be committed */
+		void* Allocate(int32 AlignedSize)
+		{
+			const int32 SizeClassIndex = AlignedSize / SizeClassGranularity - 1;
+			const int32 ElementSize = GetElementSize(SizeClassIndex);
+			FSizeClass& SizeClass = SizeClasses[SizeClassIndex];
+
+			FScopeLock SizeClassLock(&SizeClass.Mutex);
+			FSlab* Slab = SizeClass.PartialSlabs;
+			if (!Slab)
+			{
+				Slab = CommitSlab();
+				if (!Slab)
+				{
+					return nullptr;
+				}
+				Slab->FreeList = nullptr;
+				Slab->SizeClassIndex = SizeClassIndex;
+				Slab->NumLive = 0;
+				Slab->NumCarved = 0;
+				Slab->Capacity = (int32)((SlabSize - (Slab->GetObjects() - (uint8*)Slab)) / ElementSize);
+				LinkSlab(SizeClass, Slab);
+				SizeClass.NumSlabs++;
+			}
+
+			void* Result;
+			if (Slab->FreeList)
+			{
+				Result = Slab->FreeList;
+				Slab->FreeList = *(void**)Result;
+			}
+			else
+			{
+				Result = Slab->GetObjects() + Slab->NumCarved * ElementSize;
+				Slab->NumCarved++;
+			}
+			Slab->NumLive++;
+			SizeClass.NumLive++;
+			if (Slab->NumLive == Slab->Capacity)
+			{
+				UnlinkSlab(SizeClass, Slab);
+			}
+			return Result;
+		}
+
+		/** Frees an object allocated by Allocate, the caller has checked Owns(Object) */
+		void Free(void* Object)
+		{
+			FSlab* Slab = (FSlab*)AlignDown(Object, SlabSize);
+			FSizeClass& SizeClass = SizeClasses[Slab->SizeClassIndex];
+			FScopeLock SizeClassLock(&SizeClass.Mutex);
+			checkSlow(Slab->NumLive > 0);
+			*(void**)Object = Slab->FreeList;
+			Slab->FreeList = Object;
+			if (Slab->NumLive-- == Slab->Capacity)
+			{
+				LinkSlab(SizeClass, Slab);
+			}
+			SizeClass.NumLive--;
+		}
+
+		void Trim()
+		{
+			int32 NumFreedSlabs = 0;
+			for (FSizeClass& SizeClass : SizeClasses)
+			{
+				FScopeLock SizeClassLock(&SizeClass.Mutex);
+				for (FSlab* Slab = SizeClass.PartialSlabs; Slab; )
+				{
+					FSlab* NextSlab = Slab->NextSlab;
+					if (Slab->NumLive == 0)
+					{
+						UnlinkSlab(SizeClass, Slab);
+						DecommitSlab(Slab);
+						SizeClass.NumSlabs--;
+						NumFreedSlabs++;
+					}
+					Slab = NextSlab;
+				}
+			}
+			UE_CLOG(NumFreedSlabs, LogUObjectAllocator, Verbose, TEXT("Released %d empty object slabs (%d KB)."), NumFreedSlabs, (int32)(NumFreedSlabs * SlabSize / 1024));
+		}
+	};
+}
+
+void FUObjectAllocator::EnableSizeClassPools()
+{
+	SizeClassPools = &UObjectSizeClassPools::FPools::Get();
+}
+
 /**
  * Allocates and initializes the permanent object pool
  *
@@ -79,8 +316,16 @@ UObjectBase* FUObjectAllocator::AllocateUObject(int32 Size, int32 Alignment, boo
 	}
 	else
 	{
-		// Allocate new memory of the appropriate size and alignment.
-		Result = (UObjectBase*)FMemory::Malloc( AlignedSize );
+		// Keep objects of the same size (and therefore usually of the same class) together for better locality when iterating and collecting garbage
+		if (SizeClassPools && AlignedSize <= UObjectSizeClassPools::MaxPooledObjectSize)
+		{
+			Result = (UObjectBase*)SizeClassPools->Allocate(AlignedSize);
+		}
+		if (!Result)
+		{
+			// Allocate new memory of the appropriate size and alignment.
+			Result = (UObjectBase*)FMemory::Malloc( AlignedSize );
+		}
 	}
 	return Result;
 }
@@ -97,6 +342,11 @@ void FUObjectAllocator::FreeUObject(UObjectBase *Object) const
 	// Only free memory if it was allocated directly from allocator and not from permanent object pool.
 	if( ResidesInPermanentPool(Object) == false )
 	{
+		if (SizeClassPools && SizeClassPools->Owns(Object))
+		{
+			SizeClassPools->Free(Object);
+			return;
+		}
 		FMemory::Free(Object);
 	}
 	// We only destroy objects residing in permanent object pool during the exit purge.
@@ -106,4 +356,42 @@ void FUObjectAllocator::FreeUObject(UObjectBase *Object) const
 	}
 }
 
+/**
+ * Releases object slabs that no longer contain any live objects.
+ */
+void FUObjectAllocator::TrimPools() const
+{
+	if (!SizeClassPools)
+	{
+		return;
+	}
+	SizeClassPools->Trim();
+
+	int32 NumSlabs;
+	SIZE_T SlabBytes;
+	int32 NumLiveObjects;
+	GetPoolStats(NumSlabs, SlabBytes, NumLiveObjects);
+	SET_MEMORY_STAT(STAT_UObjectSlabMemory, SlabBytes);
+	SET_DWORD_STAT(STAT_UObjectSlabLiveObjects, NumLiveObjects);
+}
 
+/**
+ * Gets the memory used by object slabs
+ */
+void FUObjectAllocator::GetPoolStats(int32& OutNumSlabs, SIZE_T& OutSlabBytes, int32& OutLiveObjects) const
+{
+	OutNumSlabs = 0;
+	OutSlabBytes = 0;
+	OutLiveObjects = 0;
+	if (!SizeClassPools)
+	{
+		return;
+	}
+	for (UObjectSizeClassPools::FSizeClass& SizeClass : SizeClassPools->SizeClasses)
+	{
+		FScopeLock SizeClassLock(&SizeClass.Mutex);
+		OutNumSlabs += SizeClass.NumSlabs;
+		OutLiveObjects += SizeClass.NumLive;
+	}
+	OutSlabBytes = OutNumSlabs * UObjectSizeClassPools::SlabSize;
+}
@@ -14,6 +14,15 @@ DEFINE_LOG_CATEGORY_STATIC(LogUObjectArray, Log, All);
 
 FUObjectClusterContainer GUObjectClusters;
 
+/** Range of object indices reserved by the current thread with FUObjectArray::ReserveUObjectIndices */
+struct FReservedUObjectIndices
+{
+	int32 NextIndex = 0;
+	int32 EndIndex = 0;
+	int32 ReservationDepth = 0;
+};
+static thread_local FReservedUObjectIndices GReservedUObjectIndices;
+
 #if STATS || ENABLE_STATNAMEDEVENTS_UOBJECT
 void FUObjectItem::CreateStatID() const
 {
@@ -217,8 +226,13 @@ void FUObjectArray::AllocateUObjectIndex(UObjectBase* Object, bool bMergingThrea
 	// Regular pool/ range.
 	else
 	{
-		int32* AvailableIndex = ObjAvailableList.Pop();
-		if (AvailableIndex)
+		FReservedUObjectIndices& Reserved = GReservedUObjectIndices;
+		if (Reserved.NextIndex < Reserved.EndIndex)
+		{
+			Index = Reserved.NextIndex++;
+			check(ObjObjects[Index].Object == nullptr);
+		}
+		else if (int32* AvailableIndex = ObjAvailableList.Pop())
 		{
 #if UE_GC_TRACK_OBJ_AVAILABLE
 			const int32 AvailableCount = ObjAvailableCount.Decrement();
@@ -254,6 +268,51 @@ void FUObjectArray::AllocateUObjectIndex(UObjectBase* Object, bool bMergingThrea
 	}
 }
 
+void FUObjectArray::ReserveUObjectIndices(int32 NumObjects)
+{
+	FReservedUObjectIndices& Reserved = GReservedUObjectIndices;
+	if (Reserved.ReservationDepth++ > 0 || NumObjects <= 1 || OpenForDisregardForGC || ObjFirstGCIndex < 0)
+	{
+		return;
+	}
+
+	// Recycled indices are handed out without locking, only reserve when new ones would have to be added
+	if (int32* AvailableIndex = ObjAvailableList.Pop())
+	{
+		ObjAvailableList.Push(AvailableIndex);
+		return;
+	}
+
+	{
+#if THREADSAFE_UOBJECTS
+		FScopeLock ObjObjectsLock(&ObjObjectsCritical);
+#else
+		check(IsInGameThread());
+#endif
+		Reserved.NextIndex = ObjObjects.AddRange(NumObjects);
+	}
+	Reserved.EndIndex = Reserved.NextIndex + NumObjects;
+}
+
+void FUObjectArray::ReleaseUObjectIndexReservation()
+{
+	FReservedUObjectIndices& Reserved = GReservedUObjectIndices;
+	check(Reserved.ReservationDepth > 0);
+	if (--Reserved.ReservationDepth > 0)
+	{
+		return;
+	}
+
+	for (int32 Index = Reserved.NextIndex; Index < Reserved.EndIndex; ++Index)
+	{
+		ObjAvailableList.Push((int32*)(uintptr_t)Index);
+#if UE_GC_TRACK_OBJ_AVAILABLE
+		ObjAvailableCount.Increment();
+#endif
+	}
+	Reserved.NextIndex = Reserved.EndIndex = 0;
+}
+
 /**
  * Removes an object from delete listeners
  *
@@ -1184,6 +1184,14 @@ static FAutoConsoleVariableRef CSizeOfPermanentObjectPool(
 	ECVF_Default
 	);
 
+static bool GUseObjectSizeClassPools;
+static FAutoConsoleVariableRef CUseObjectSizeClassPools(
+	TEXT("gc.UseObjectSizeClassPools"),
+	GUseObjectSizeClassPools,
+	TEXT("Placeholder console variable, currently not used in runtime."),
+	ECVF_Default
+	);
+
 static int32 GMaxObjectsInEditor;
 static FAutoConsoleVariableRef CMaxObjectsInEditor(
 	TEXT("gc.MaxObjectsInEditor"),
@@ -1220,6 +1228,7 @@ void UObjectBaseInit()
 	int32 SizeOfPermanentObjectPool = 0;
 	int32 MaxUObjects = 2 * 1024 * 1024; // Default to ~2M UObjects
 	bool bPreAllocateUObjectArray = false;	
+	bool bUseObjectSizeClassPools = false;
 
 	// To properly set MaxObjectsNotConsideredByGC look for "Log: XXX objects as part of root set at end of initial load."
 	// in your log file. This is being logged from LaunchEnglineLoop after objects have been added to the root set. 
@@ -1275,8 +1284,16 @@ void UObjectBaseInit()
 	UE_LOG(LogInit, Log, TEXT("%s for max %d objects, including %i objects not considered by GC, pre-allocating %i bytes for permanent pool."), 
 		bPreAllocateUObjectArray ? TEXT("Pre-allocating") : TEXT("Presizing"),
 		MaxUObjects, MaxObjectsNotConsideredByGC, SizeOfPermanentObjectPool);
+	// If true, objects are allocated from size class segregated slabs. Read before the first object is allocated.
+	GConfig->GetBool(TEXT("/Script/Engine.GarbageCollectionSettings"), TEXT("gc.UseObjectSizeClassPools"), bUseObjectSizeClassPools, GEngineIni);
+	UE_CLOG(bUseObjectSizeClassPools, LogInit, Log, TEXT("Allocating objects from size class pools."));
+
 	//初始化对象分配器
 	GUObjectAllocator.AllocatePermanentObjectPool(SizeOfPermanentObjectPool);
+	if (bUseObjectSizeClassPools)
+	{
+		GUObjectAllocator.EnableSizeClassPools();
+	}
 	//初始化对象管理数组
 	GUObjectArray.AllocateObjectPool(MaxUObjects, MaxObjectsNotConsideredByGC, bPreAllocateUObjectArray);
 
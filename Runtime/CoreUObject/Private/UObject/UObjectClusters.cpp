@@ -19,7 +19,12 @@
 #include "UObject/LinkerLoad.h"
 #include "UObject/FastReferenceCollector.h"
 #include "UObject/Package.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/FindStronglyConnected.h"
+#include "Serialization/ArchiveFindAllRefs.h"
 #include "Misc/CommandLine.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/ObjectRedirector.h"
 
 int32 GCreateGCClusters = 1;
 static FAutoConsoleVariableRef CCreateGCClusters(
@@ -45,6 +50,30 @@ static FAutoConsoleVariableRef CMinGCClusterSize(
 	ECVF_Default
 );
 
+int32 GAutoClusteringEnabled = 0;
+static FAutoConsoleVariableRef CVarAutoClusteringEnabled(
+	TEXT("gc.AutoClusteringEnabled"),
+	GAutoClusteringEnabled,
+	TEXT("If true, the engine will periodically analyze the reference graph of loaded objects and create clusters from large, stable subgraphs."),
+	ECVF_Default
+);
+
+int32 GAutoClusteringInterval = 10;
+static FAutoConsoleVariableRef CVarAutoClusteringInterval(
+	TEXT("gc.AutoClusteringInterval"),
+	GAutoClusteringInterval,
+	TEXT("Number of garbage collections between automatic clustering passes."),
+	ECVF_Default
+);
+
+int32 GAutoClusterMinSize = 64;
+static FAutoConsoleVariableRef CVarAutoClusterMinSize(
+	TEXT("gc.AutoClusterMinSize"),
+	GAutoClusterMinSize,
+	TEXT("Minimum number of objects a subgraph needs to have to be turned into a cluster automatically."),
+	ECVF_Default
+);
+
 FUObjectClusterContainer::FUObjectClusterContainer()
 	: NumAllocatedClusters(0)
 	, bClustersNeedDissolving(false)
@@ -98,6 +127,7 @@ void FUObjectClusterContainer::FreeCluster(int32 InClusterIndex)
 	Cluster.ReferencedClusters.Reset();
 	Cluster.ReferencedByClusters.Reset();
 	Cluster.bNeedsDissolving = false;
+	Cluster.bAutoCreated = false;
 	FreeClusterIndices.Add(InClusterIndex);
 	NumAllocatedClusters--;
 	check(NumAllocatedClusters >= 0);
@@ -544,6 +574,61 @@ void DumpRefsToCluster(const TArray<FString>& Args)
 }
 
 
+void ReportClusterEffectiveness(const TArray<FString>& Args)
+{
+	const bool bDetailed = Args.Contains(TEXT("Detailed"));
+	int32 NumClusters = 0;
+	int32 NumAutoClusters = 0;
+	int32 NumClusteredObjects = 0;
+	int32 NumAutoClusteredObjects = 0;
+	int32 NumMutableReferences = 0;
+	int32 NumClusterReferences = 0;
+
+	for (FUObjectCluster& Cluster : GUObjectClusters.GetClustersUnsafe())
+	{
+		if (Cluster.RootIndex == INDEX_NONE)
+		{
+			continue;
+		}
+		NumClusters++;
+		NumClusteredObjects += Cluster.Objects.Num();
+		NumMutableReferences += Cluster.MutableObjects.Num();
+		NumClusterReferences += Cluster.ReferencedClusters.Num();
+		if (Cluster.bAutoCreated)
+		{
+			NumAutoClusters++;
+			NumAutoClusteredObjects += Cluster.Objects.Num();
+		}
+		if (bDetailed)
+		{
+			FUObjectItem* RootItem = GUObjectArray.IndexToObjectUnsafeForGC(Cluster.RootIndex);
+			UE_LOG(LogObj, Display, TEXT("%s%s: Objects: %d, Mutable: %d (%.1f%%), ReferencedClusters: %d"),
+				*static_cast<UObject*>(RootItem->Object)->GetFullName(),
+				Cluster.bAutoCreated ? TEXT(" (auto)") : TEXT(""),
+				Cluster.Objects.Num(),
+				Cluster.MutableObjects.Num(),
+				Cluster.Objects.Num() ? (100.0f * Cluster.MutableObjects.Num() / Cluster.Objects.Num()) : 0.0f,
+				Cluster.ReferencedClusters.Num());
+		}
+	}
+
+	const int32 NumGCObjects = FMath::Max(1, GUObjectArray.GetObjectArrayNumMinusPermanent());
+	// Reachability analysis only visits cluster roots, their mutable objects and referenced clusters, never the objects inside of a cluster
+	const int32 EstimatedObjectsSkipped = FMath::Max(0, NumClusteredObjects - NumMutableReferences - NumClusterReferences);
+
+	UE_LOG(LogObj, Display, TEXT("Clusters: %d (%d created automatically)"), NumClusters, NumAutoClusters);
+	UE_LOG(LogObj, Display, TEXT("Objects in clusters: %d (%d in automatic clusters)"), NumClusteredObjects, NumAutoClusteredObjects);
+	UE_LOG(LogObj, Display, TEXT("Garbage collected objects covered by clusters: %.1f%%"), 100.0f * NumClusteredObjects / NumGCObjects);
+	UE_LOG(LogObj, Display, TEXT("Mutable object references: %d, cluster-to-cluster references: %d"), NumMutableReferences, NumClusterReferences);
+	UE_LOG(LogObj, Display, TEXT("Estimated objects skipped by reachability analysis: %d (%.1f%% of garbage collected objects)"), EstimatedObjectsSkipped, 100.0f * EstimatedObjectsSkipped / NumGCObjects);
+}
+
+static void CreateAutoClusters(const TArray<FString>& Args)
+{
+	const int32 NumCreated = CreateAutomaticClusters(Args.Contains(TEXT("Force")));
+	UE_LOG(LogObj, Display, TEXT("Created %d automatic clusters."), NumCreated);
+}
+
 static FAutoConsoleCommand ListClustersCommand(
 	TEXT("gc.ListClusters"),
 	TEXT("Dumps all clusters do output log. When 'Hiearchy' argument is specified lists all objects inside clusters."),
@@ -562,6 +647,18 @@ static FAutoConsoleCommand DumpRefsToClusterCommand(
 	FConsoleCommandWithArgsDelegate::CreateStatic(DumpRefsToCluster)
 );
 
+static FAutoConsoleCommand ReportClusterEffectivenessCommand(
+	TEXT("gc.ReportClusterEffectiveness"),
+	TEXT("Dumps cluster coverage and estimated reachability analysis savings to output log. Specify 'Detailed' to list every cluster."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(ReportClusterEffectiveness)
+);
+
+static FAutoConsoleCommand CreateAutoClustersCommand(
+	TEXT("gc.CreateAutoClusters"),
+	TEXT("Analyzes the reference graph of loaded objects and creates clusters from large subgraphs. Specify 'Force' to skip the stability requirement."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(CreateAutoClusters)
+);
+
 #endif // !UE_BUILD_SHIPPING
 
 /**
@@ -867,3 +964,294 @@ void UObjectBaseUtility::CreateCluster()
 	}
 }
 
+/** Roots proposed by the previous automatic clustering pass. A root has to be proposed by two consecutive passes to be considered stable. */
+static TSet<FObjectKey> GPreviousAutoClusterRoots;
+
+/** Returns true if the object can be considered by the automatic clustering pass */
+static bool IsAutoClusterCandidate(FUObjectItem* ObjectItem)
+{
+	UObject* Object = static_cast<UObject*>(ObjectItem->Object);
+	if (!Object ||
+		ObjectItem->IsUnreachable() || 
+		ObjectItem->IsPendingKill() || 
+		ObjectItem->IsRootSet() ||
+		ObjectItem->GetOwnerIndex() != 0 ||
+		ObjectItem->HasAnyFlags(EInternalObjectFlags::ClusterRoot | EInternalObjectFlags::Async | EInternalObjectFlags::AsyncLoading) ||
+		GUObjectArray.IsDisregardForGC(Object))
+	{
+		return false;
+	}
+	// Only fully loaded content is treated as mostly immutable. Objects created at runtime tend to change their references
+	// and references added after the cluster has been created would not be seen by reachability analysis.
+	if (!Object->HasAnyFlags(RF_WasLoaded) || Object->HasAnyFlags(RF_NeedLoad | RF_NeedPostLoad | RF_Transient | RF_ClassDefaultObject))
+	{
+		return false;
+	}
+	// Loaded levels are full of actors and components that gameplay keeps re-referencing, so only objects that belong to
+	// a standalone asset outside of map packages are considered
+	UPackage* Package = Object->GetOutermost();
+	if (Object == Package || Package->HasAnyPackageFlags(PKG_ContainsMap | PKG_ContainsMapData | PKG_PlayInEditor | PKG_CompiledIn))
+	{
+		return false;
+	}
+	UObject* Asset = Object;
+	while (Asset->GetOuter() != Package)
+	{
+		Asset = Asset->GetOuter();
+	}
+	if (!Asset->HasAnyFlags(RF_Standalone) || Asset->HasAnyFlags(RF_Transient))
+	{
+		return false;
+	}
+	return Object->CanBeInCluster();
+}
+
+/**
+ * Creates clusters from the large subgraphs of the reference graph restricted to the candidates
+ * @param Candidates Objects that passed IsAutoClusterCandidate()
+ * @param StableRoots Roots proposed by the previous pass, only these are clustered unless bForce is true
+ * @param bForce if true, clusters roots that are not in StableRoots
+ * @param OutProposedRoots Receives the roots of all subgraphs large enough to be clustered
+ * @return Number of clusters created
+ */
+static int32 CreateAutomaticClustersFromCandidates(const TArray<UObject*>& Candidates, const TSet<FObjectKey>& StableRoots, bool bForce, TSet<FObjectKey>& OutProposedRoots)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TSet<UObject*> CandidateSet(Candidates);
+
+	// Build the reference graph restricted to candidates and collapse it into strongly connected components
+	FFindStronglyConnected Graph;
+	for (UObject* Object : Candidates)
+	{
+		FArchiveFindAllRefs ArFind(Object);
+		for (UObject* Reference : ArFind.References)
+		{
+			if (Reference != Object && CandidateSet.Contains(Reference))
+			{
+				Graph.Edges.AddUnique(Object, Reference);
+			}
+		}
+	}
+	for (UObject* Object : Candidates)
+	{
+		Graph.StrongConnect(Object);
+	}
+
+	TMap<UObject*, int32> ObjectToComponent;
+	ObjectToComponent.Reserve(Candidates.Num());
+	for (int32 ComponentIndex = 0; ComponentIndex < Graph.Components.Num(); ++ComponentIndex)
+	{
+		for (UObject* Object : Graph.Components[ComponentIndex])
+		{
+			ObjectToComponent.Add(Object, ComponentIndex);
+		}
+	}
+	TArray<int32> ComponentInDegree;
+	ComponentInDegree.AddZeroed(Graph.Components.Num());
+	for (TMultiMap<UObject*, UObject*>::TConstIterator It(Graph.Edges); It; ++It)
+	{
+		const int32 FromComponent = ObjectToComponent.FindChecked(It.Key());
+		const int32 ToComponent = ObjectToComponent.FindChecked(It.Value());
+		if (FromComponent != ToComponent)
+		{
+			ComponentInDegree[ToComponent]++;
+		}
+	}
+
+	// Components nothing else (among the candidates) references are the roots of the subgraphs. Tarjan's algorithm 
+	// emits components in reverse topological order so walk them backwards to process the outermost subgraphs first.
+	TSet<UObject*> ClaimedObjects;
+	TArray<UObject*> Subgraph;
+	TArray<UObject*> References;
+	int32 NumCreatedClusters = 0;
+	for (int32 ComponentIndex = Graph.Components.Num() - 1; ComponentIndex >= 0; --ComponentIndex)
+	{
+		if (ComponentInDegree[ComponentIndex] != 0)
+		{
+			continue;
+		}
+		const TArray<UObject*>& Component = Graph.Components[ComponentIndex];
+		UObject* const* TopLevelObject = Component.FindByPredicate([](UObject* Object) { return Object->GetOuter() && Object->GetOuter()->IsA<UPackage>(); });
+		UObject* Root = TopLevelObject ? *TopLevelObject : Component[0];
+		if (ClaimedObjects.Contains(Root))
+		{
+			continue;
+		}
+
+		// Estimate the cluster size by walking the subgraph that hasn't already been claimed by another cluster
+		Subgraph.Reset();
+		Subgraph.Add(Root);
+		TSet<UObject*> Visited;
+		Visited.Add(Root);
+		for (int32 Index = 0; Index < Subgraph.Num(); ++Index)
+		{
+			References.Reset();
+			Graph.Edges.MultiFind(Subgraph[Index], References);
+			for (UObject* Reference : References)
+			{
+				if (!ClaimedObjects.Contains(Reference) && !Visited.Contains(Reference))
+				{
+					Visited.Add(Reference);
+					Subgraph.Add(Reference);
+				}
+			}
+		}
+		if (Subgraph.Num() < GAutoClusterMinSize)
+		{
+			continue;
+		}
+
+		const FObjectKey RootKey(Root);
+		OutProposedRoots.Add(RootKey);
+		if (!bForce && !StableRoots.Contains(RootKey))
+		{
+			continue;
+		}
+		ClaimedObjects.Append(Subgraph);
+
+		Root->CreateCluster();
+		FUObjectItem* RootItem = GUObjectArray.ObjectToObjectItem(Root);
+		if (RootItem->HasAnyFlags(EInternalObjectFlags::ClusterRoot))
+		{
+			FUObjectCluster& Cluster = GUObjectClusters[RootItem->GetClusterIndex()];
+			if (Cluster.Objects.Num() >= GAutoClusterMinSize)
+			{
+				Cluster.bAutoCreated = true;
+				NumCreatedClusters++;
+#if UE_GCCLUSTER_VERBOSE_LOGGING
+				UE_LOG(LogObj, Log, TEXT("Created automatic cluster %s with %d objects and %d mutable objects."), *Root->GetFullName(), Cluster.Objects.Num(), Cluster.MutableObjects.Num());
+#endif
+			}
+			else
+			{
+				// The token stream disagreed with the serialized references, not worth keeping
+				GUObjectClusters.DissolveCluster(Root);
+			}
+		}
+	}
+
+	UE_LOG(LogObj, Log, TEXT("%f ms for creating %d automatic GC clusters (%d candidate objects, %d components)"),
+		(FPlatformTime::Seconds() - StartTime) * 1000, NumCreatedClusters, Candidates.Num(), Graph.Components.Num());
+
+	return NumCreatedClusters;
+}
+
+int32 CreateAutomaticClusters(bool bForce /* = false */)
+{
+	if (!CanCreateObjectClusters())
+	{
+		return 0;
+	}
+	check(IsInGameThread());
+
+	// The pass runs without the GC lock, objects created or loaded by another thread while it runs would be missed
+	if (IsLoading() || IsAsyncLoading())
+	{
+		UE_LOG(LogObj, Log, TEXT("Skipped creating automatic GC clusters while loading."));
+		return 0;
+	}
+
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("CreateAutomaticClusters"), STAT_CreateAutomaticClusters, STATGROUP_GC);
+
+	TArray<UObject*> Candidates;
+	for (FRawObjectIterator It(true); It; ++It)
+	{
+		FUObjectItem* ObjectItem = *It;
+		if (IsAutoClusterCandidate(ObjectItem))
+		{
+			Candidates.Add(static_cast<UObject*>(ObjectItem->Object));
+		}
+	}
+
+	TSet<FObjectKey> ProposedRoots;
+	const int32 NumCreatedClusters = CreateAutomaticClustersFromCandidates(Candidates, GPreviousAutoClusterRoots, bForce, ProposedRoots);
+	GPreviousAutoClusterRoots = MoveTemp(ProposedRoots);
+	return NumCreatedClusters;
+}
+
+void TickAutomaticClustering()
+{
+	static int32 NumCollectionsSinceLastPass = 0;
+	if (!GAutoClusteringEnabled || !GCreateGCClusters)
+	{
+		NumCollectionsSinceLastPass = 0;
+		return;
+	}
+
+	// CreateAutomaticClusters() skips the pass while loading, keep counting so that it runs once loading is done
+	if (++NumCollectionsSinceLastPass >= FMath::Max(1, GAutoClusteringInterval) && !IsLoading() && !IsAsyncLoading())
+	{
+		NumCollectionsSinceLastPass = 0;
+		CreateAutomaticClusters();
+	}
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAutomaticClusteringTest, "System.CoreUObject.GC.AutomaticClustering", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+bool FAutomaticClusteringTest::RunTest(const FString& Parameters)
+{
+	if (!GCreateGCClusters)
+	{
+		AddInfo(TEXT("Skipped, gc.CreateGCClusters is disabled."));
+		return true;
+	}
+	TGuardValue<int32> MinClusterSize(GAutoClusterMinSize, 8);
+
+	// A chain of loaded-looking standalone assets, each one referencing the next
+	const int32 NumObjects = 16;
+	UPackage* Package = NewObject<UPackage>(nullptr, MakeUniqueObjectName(nullptr, UPackage::StaticClass(), TEXT("/Temp/AutomaticClusteringTest")), RF_Transient);
+	TArray<UObjectRedirector*> Objects;
+	for (int32 Index = 0; Index < NumObjects; ++Index)
+	{
+		Objects.Add(NewObject<UObjectRedirector>(Package, NAME_None, RF_Public | RF_Standalone | RF_WasLoaded | RF_LoadCompleted));
+	}
+	for (int32 Index = 0; Index < NumObjects - 1; ++Index)
+	{
+		Objects[Index]->DestinationObject = Objects[Index + 1];
+	}
+
+	TArray<UObject*> Candidates;
+	for (UObject* Object : Objects)
+	{
+		if (IsAutoClusterCandidate(GUObjectArray.ObjectToObjectItem(Object)))
+		{
+			Candidates.Add(Object);
+		}
+	}
+	TestEqual(TEXT("Candidates"), Candidates.Num(), NumObjects);
+
+	// The first pass only proposes the root, the second one clusters it once it has proven stable
+	TSet<FObjectKey> ProposedRoots;
+	TestEqual(TEXT("Clusters created by the first pass"), CreateAutomaticClustersFromCandidates(Candidates, TSet<FObjectKey>(), false, ProposedRoots), 0);
+	TestTrue(TEXT("The head of the chain is proposed as the root"), ProposedRoots.Num() == 1 && ProposedRoots.Contains(FObjectKey(Objects[0])));
+
+	TSet<FObjectKey> StableRoots = MoveTemp(ProposedRoots);
+	TestEqual(TEXT("Clusters created by the second pass"), CreateAutomaticClustersFromCandidates(Candidates, StableRoots, false, ProposedRoots), 1);
+
+	FUObjectItem* RootItem = GUObjectArray.ObjectToObjectItem(Objects[0]);
+	if (TestTrue(TEXT("The head of the chain is a cluster root"), RootItem->HasAnyFlags(EInternalObjectFlags::ClusterRoot)))
+	{
+		TestTrue(TEXT("The cluster is marked as created automatically"), GUObjectClusters[RootItem->GetClusterIndex()].bAutoCreated);
+		const int32 RootIndex = GUObjectArray.ObjectToIndex(Objects[0]);
+		for (int32 Index = 1; Index < NumObjects; ++Index)
+		{
+			TestEqual(TEXT("Referenced object is owned by the cluster"), GUObjectArray.ObjectToObjectItem(Objects[Index])->GetOwnerIndex(), RootIndex);
+		}
+		TestFalse(TEXT("Clustered objects are no longer candidates"), IsAutoClusterCandidate(GUObjectArray.ObjectToObjectItem(Objects[1])));
+
+		GUObjectClusters.DissolveCluster(Objects[0]);
+	}
+
+	for (UObject* Object : Objects)
+	{
+		Object->ClearFlags(RF_Standalone);
+		Object->MarkPendingKill();
+	}
+	Package->MarkPendingKill();
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
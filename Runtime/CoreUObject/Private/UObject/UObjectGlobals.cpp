@@ -268,7 +268,7 @@ struct FPerClassNumberSuffixAnnotation
 int32 UpdateSuffixForNextNewObject(UObject* Parent, const UClass* Class, TFunctionRef<void(int32&)> IndexMutator)
 {
 	static FCriticalSection PerClassNumberSuffixAnnotationMutex;
-	static FUObjectAnnotationDense<FPerClassNumberSuffixAnnotation, true> PerClassNumberSuffixAnnotation;
+	static FUObjectAnnotationDenseLockFree<FPerClassNumberSuffixAnnotation, true> PerClassNumberSuffixAnnotation;
 
 	FPerClassNumberSuffixAnnotation& Annotation = PerClassNumberSuffixAnnotation.GetAnnotationRef(Parent);
 	FScopeLock Lock(&PerClassNumberSuffixAnnotationMutex);
@@ -10,10 +10,13 @@
 #include "Misc/AsciiSet.h"
 #include "Misc/PackageName.h"
 #include "HAL/IConsoleManager.h"
+#include "Misc/ScopeRWLock.h"
+#include "Async/ParallelFor.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUObjectHash, Log, All);
 
 DECLARE_CYCLE_STAT( TEXT( "GetObjectsOfClass" ), STAT_Hash_GetObjectsOfClass, STATGROUP_UObjectHash );
+DECLARE_CYCLE_STAT( TEXT( "GetObjectIndicesOfClass" ), STAT_Hash_GetObjectIndicesOfClass, STATGROUP_UObjectHash );
 DECLARE_CYCLE_STAT( TEXT( "HashObject" ), STAT_Hash_HashObject, STATGROUP_UObjectHash );
 DECLARE_CYCLE_STAT( TEXT( "UnhashObject" ), STAT_Hash_UnhashObject, STATGROUP_UObjectHash );
 
@@ -416,6 +419,137 @@ public:
 	}
 };
 
+/**
+ * Packed per-class lists of object indices. Mirrors ClassToObjectListMap and ClassToChildListMap but is guarded by its own
+ * read-write lock so that class-filtered queries don't have to take the global hash tables lock and don't have to walk TSet buckets.
+ * Modified only from AddToClassMap / RemoveFromClassMap which run under the hash tables lock.
+ */
+class FUObjectClassIndex
+{
+	FRWLock Lock;
+
+	/** Indices of all objects of a class (not including derived classes) */
+	TMap<const UClass*, TArray<int32>> ClassToObjectIndices;
+	/** Direct children of a class */
+	TMap<const UClass*, TArray<const UClass*>> ClassToChildClasses;
+	/** Position of each object in its class list, indexed by the object index. Allows removal with RemoveAtSwap. */
+	TArray<int32> ObjectListPositions;
+
+	/** Gathers the class and all of its derived classes. Assumes the lock is held. */
+	template<typename ArrayAllocator>
+	void GatherClassesToSearch(const UClass* ClassToLookFor, bool bIncludeDerivedClasses, TArray<const UClass*, ArrayAllocator>& OutClasses) const
+	{
+		OutClasses.Add(ClassToLookFor);
+		if (bIncludeDerivedClasses)
+		{
+			for (int32 SearchIndex = 0; SearchIndex < OutClasses.Num(); ++SearchIndex)
+			{
+				if (const TArray<const UClass*>* ChildClasses = ClassToChildClasses.Find(OutClasses[SearchIndex]))
+				{
+					OutClasses.Append(*ChildClasses);
+				}
+			}
+		}
+	}
+
+public:
+
+	void AddObject(const UClass* Class, int32 ObjectIndex)
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_Write);
+		TArray<int32>& ObjectIndices = ClassToObjectIndices.FindOrAdd(Class);
+		if (ObjectIndex >= ObjectListPositions.Num())
+		{
+			ObjectListPositions.AddUninitialized(FMath::Max(ObjectIndex + 1, GUObjectArray.GetObjectArrayNum()) - ObjectListPositions.Num());
+		}
+		ObjectListPositions[ObjectIndex] = ObjectIndices.Add(ObjectIndex);
+	}
+
+	void RemoveObject(const UClass* Class, int32 ObjectIndex)
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_Write);
+		TArray<int32>* ObjectIndices = ClassToObjectIndices.Find(Class);
+		check(ObjectIndices && ObjectListPositions.IsValidIndex(ObjectIndex));
+		const int32 Position = ObjectListPositions[ObjectIndex];
+		check((*ObjectIndices)[Position] == ObjectIndex);
+		ObjectIndices->RemoveAtSwap(Position, 1, false);
+		if (Position < ObjectIndices->Num())
+		{
+			ObjectListPositions[(*ObjectIndices)[Position]] = Position;
+		}
+		else if (ObjectIndices->Num() == 0)
+		{
+			ClassToObjectIndices.Remove(Class);
+		}
+	}
+
+	void AddClass(const UClass* SuperClass, const UClass* Class)
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_Write);
+		ClassToChildClasses.FindOrAdd(SuperClass).Add(Class);
+	}
+
+	void RemoveClass(const UClass* SuperClass, const UClass* Class)
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_Write);
+		if (TArray<const UClass*>* ChildClasses = ClassToChildClasses.Find(SuperClass))
+		{
+			ChildClasses->RemoveSingleSwap(Class, false);
+			if (ChildClasses->Num() == 0)
+			{
+				ClassToChildClasses.Remove(SuperClass);
+			}
+		}
+	}
+
+	/** Copies the indices of all objects of the specified class into OutObjectIndices */
+	void GetObjectIndices(const UClass* ClassToLookFor, bool bIncludeDerivedClasses, TArray<int32>& OutObjectIndices)
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+		// Most classes searched for have around 10 subclasses, some have hundreds
+		TArray<const UClass*, TInlineAllocator<16>> ClassesToSearch;
+		GatherClassesToSearch(ClassToLookFor, bIncludeDerivedClasses, ClassesToSearch);
+
+		int32 NumObjects = 0;
+		for (const UClass* SearchClass : ClassesToSearch)
+		{
+			if (const TArray<int32>* ObjectIndices = ClassToObjectIndices.Find(SearchClass))
+			{
+				NumObjects += ObjectIndices->Num();
+			}
+		}
+		OutObjectIndices.Reserve(OutObjectIndices.Num() + NumObjects);
+		for (const UClass* SearchClass : ClassesToSearch)
+		{
+			if (const TArray<int32>* ObjectIndices = ClassToObjectIndices.Find(SearchClass))
+			{
+				OutObjectIndices.Append(*ObjectIndices);
+			}
+		}
+	}
+
+	SIZE_T GetAllocatedSize()
+	{
+		FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+		SIZE_T Size = ClassToObjectIndices.GetAllocatedSize() + ClassToChildClasses.GetAllocatedSize() + ObjectListPositions.GetAllocatedSize();
+		for (const TPair<const UClass*, TArray<int32>>& Pair : ClassToObjectIndices)
+		{
+			Size += Pair.Value.GetAllocatedSize();
+		}
+		for (const TPair<const UClass*, TArray<const UClass*>>& Pair : ClassToChildClasses)
+		{
+			Size += Pair.Value.GetAllocatedSize();
+		}
+		return Size;
+	}
+
+	static FUObjectClassIndex& Get()
+	{
+		static FUObjectClassIndex Singleton;
+		return Singleton;
+	}
+};
+
 /**
  * Calculates the object's hash just using the object's name index
  *
@@ -742,6 +876,7 @@ FORCEINLINE static void AddToClassMap(FUObjectHashTables& ThreadHash, UObjectBas
 		check(Object->GetClass());
 		FHashBucket& ObjectList = ThreadHash.ClassToObjectListMap.FindOrAdd(Object->GetClass());
 		ObjectList.Add(Object);
+		FUObjectClassIndex::Get().AddObject(Object->GetClass(), GUObjectArray.ObjectToIndex(Object));
 	}
 
 	UObjectBaseUtility* ObjectWithUtility = static_cast<UObjectBaseUtility*>(Object);
@@ -756,6 +891,7 @@ FORCEINLINE static void AddToClassMap(FUObjectHashTables& ThreadHash, UObjectBas
 			ChildList.Add(Class, &bIsAlreadyInSetPtr);
 			ThreadHash.ClassToChildListMapVersion++;
 			check(!bIsAlreadyInSetPtr); // if it already exists, something is wrong with the external code
+			FUObjectClassIndex::Get().AddClass(SuperClass, Class);
 		}
 	}
 }
@@ -809,6 +945,7 @@ FORCEINLINE static void RemoveFromClassMap(FUObjectHashTables& ThreadHash, UObje
 		{
 			ThreadHash.ClassToObjectListMap.Remove(Object->GetClass());
 		}
+		FUObjectClassIndex::Get().RemoveObject(Object->GetClass(), GUObjectArray.ObjectToIndex(Object));
 	}
 
 	if ( ObjectWithUtility->IsA(UClass::StaticClass()) )
@@ -829,6 +966,7 @@ FORCEINLINE static void RemoveFromClassMap(FUObjectHashTables& ThreadHash, UObje
 				ThreadHash.ClassToChildListMap.Remove(SuperClass);
 			}
 			ThreadHash.ClassToChildListMapVersion++;
+			FUObjectClassIndex::Get().RemoveClass(SuperClass, Class);
 		}
 	}
 }
@@ -1151,6 +1289,54 @@ void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject *>& Results,
 	check(Results.Num() <= GUObjectArray.GetObjectArrayNum()); // otherwise we have a cycle in the outer chain, which should not be possible
 }
 
+void GetObjectIndicesOfClass(const UClass* ClassToLookFor, TArray<int32>& OutObjectIndices, bool bIncludeDerivedClasses, EObjectOfClassOrder Order)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Hash_GetObjectIndicesOfClass);
+
+	FUObjectClassIndex::Get().GetObjectIndices(ClassToLookFor, bIncludeDerivedClasses, OutObjectIndices);
+	if (Order == EObjectOfClassOrder::ObjectIndex)
+	{
+		OutObjectIndices.Sort();
+	}
+}
+
+void ParallelForEachObjectOfClass(const UClass* ClassToLookFor, TFunctionRef<void(UObject*)> Operation, bool bIncludeDerivedClasses, EObjectFlags ExclusionFlags, EInternalObjectFlags ExclusionInternalFlags, EObjectOfClassOrder Order, bool bForceSingleThreaded)
+{
+	// We don't want to return any objects that are currently being background loaded unless we're using the object iterator during async loading.
+	ExclusionInternalFlags |= EInternalObjectFlags::Unreachable;
+	if (!IsInAsyncLoadingThread())
+	{
+		ExclusionInternalFlags |= EInternalObjectFlags::AsyncLoading;
+	}
+
+	// Objects are resolved from their indices under the hash tables lock. The class index is only modified under that lock
+	// too and objects can't be unhashed while it's held, so every index still refers to a live object of the class.
+	TArray<UObject*> Objects;
+	{
+		FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
+		FHashTableLock HashLock(ThreadHash);
+
+		TArray<int32> ObjectIndices;
+		GetObjectIndicesOfClass(ClassToLookFor, ObjectIndices, bIncludeDerivedClasses, Order);
+
+		Objects.Reserve(ObjectIndices.Num());
+		for (int32 ObjectIndex : ObjectIndices)
+		{
+			FUObjectItem* ObjectItem = GUObjectArray.IndexToObjectUnsafeForGC(ObjectIndex);
+			UObject* Object = static_cast<UObject*>(ObjectItem->Object);
+			if (!ObjectItem->HasAnyFlags(ExclusionInternalFlags) && !Object->HasAnyFlags(ExclusionFlags))
+			{
+				Objects.Add(Object);
+			}
+		}
+	}
+
+	ParallelFor(Objects.Num(), [&Objects, &Operation](int32 Index)
+	{
+		Operation(Objects[Index]);
+	}, bForceSingleThreaded);
+}
+
 FORCEINLINE void ForEachObjectOfClasses_Implementation(FUObjectHashTables& ThreadHash, TArrayView<const UClass*> ClassesToLookFor, TFunctionRef<void(UObject*)> Operation, EObjectFlags ExcludeFlags /*= RF_ClassDefaultObject*/, EInternalObjectFlags ExclusionInternalFlags /*= EInternalObjectFlags::None*/)
 {
 	// We don't want to return any objects that are currently being background loaded unless we're using the object iterator during async loading.
@@ -1628,6 +1814,15 @@ void LogHashMemoryOverheadStatistics(FOutputDevice& Ar, const bool bShowIndividu
 		TotalSize += Size;
 	}
 
+	{
+		int64 Size = (int64)FUObjectClassIndex::Get().GetAllocatedSize();
+		if (bShowIndividualStats)
+		{
+			Ar.Logf(TEXT("Memory used by UClass To UObject Index Lists: %lld bytes."), Size);
+		}
+		TotalSize += Size;
+	}
+
 	{
 		int64 Size = HashTables.PackageToObjectListMap.GetAllocatedSize();
 		for (const TPair<UPackage*, FHashBucket>& Pair : HashTables.PackageToObjectListMap)
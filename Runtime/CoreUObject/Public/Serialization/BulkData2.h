@@ -193,6 +193,20 @@ public:
 
 	static IBulkDataIORequest* CreateStreamingRequestForRange(const BulkDataRangeArray& RangeArray, EAsyncIOPriorityAndFlags Priority, FBulkDataIORequestCallBack* CompleteCallback);
 
+	/**
+	 * Adds a read of a range of the payload to an I/O batch created with GetIoDispatcher()->NewBatch(), so that ranges of
+	 * several bulk data objects can be read with a single batch. Compressed blocks are decompressed straight into the destination.
+	 *
+	 * @param Batch				The batch to add the read to, the caller issues it
+	 * @param OffsetInBulkData	Offset of the range within the payload
+	 * @param BytesToRead		Size of the range
+	 * @param Priority			I/O dispatcher priority of the read
+	 * @param Callback			Called on completion with a buffer wrapping TargetVa, or owning the memory the dispatcher allocated when TargetVa is null
+	 * @param TargetVa			Optional caller owned memory of at least BytesToRead bytes to read into
+	 * @return					False if the bulk data is not using the I/O dispatcher, in which case nothing was added and the callback is not called
+	 */
+	bool ReadRange(FIoBatch& Batch, int64 OffsetInBulkData, int64 BytesToRead, int32 Priority, FIoReadCallback&& Callback, void* TargetVa = nullptr) const;
+
 	void RemoveBulkData();
 
 	/**
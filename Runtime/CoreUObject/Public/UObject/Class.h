@@ -343,6 +343,9 @@ public:
 	/** Cached schema for optimized unversioned property serialization, owned by this. */
 	mutable const struct FUnversionedStructSchema* UnversionedSchema = nullptr;
 
+	/** Memoized property tag resolution plans for tagged property loading. This holds a reference, loads using the plans hold their own. */
+	mutable struct FTaggedPropertyLoadPlans* TaggedPropertyLoadPlans = nullptr;
+
 public:
 	// Constructors.
 	UStruct( EStaticConstructor, int32 InSize, int32 InAlignment, EObjectFlags InFlags );
@@ -585,6 +585,86 @@ private:
 		}
 	}
 
+#if UE_GC_USE_REFERENCE_SCHEMA
+	/**
+	 * Processes a list of object references from a compiled reference schema
+	 * @param References References to process
+	 * @param Data Memory the reference offsets are relative to
+	 * @param NewObjectsToSerialize List of new objects to process as a result of processing the references
+	 * @param CurrentObject current object being processed
+	 * @param bAllowReferenceElimination True if the references can be nulled out
+	 */
+	FORCEINLINE_DEBUGGABLE void ProcessSchemaReferenceList(const FGCReferenceSchema::FReferenceList& References, uint8* Data, TArray<UObject*>& NewObjectsToSerialize, UObject* CurrentObject, bool bAllowReferenceElimination)
+	{
+		const uint32* RESTRICT Offsets = References.Offsets.GetData();
+		const uint32* RESTRICT TokenIndices = References.TokenIndices.GetData();
+		for (int32 ReferenceIndex = 0, ReferenceNum = References.Num(); ReferenceIndex < ReferenceNum; ++ReferenceIndex)
+		{
+			UObject*& Object = *(UObject**)(Data + Offsets[ReferenceIndex]);
+			ReferenceProcessor.HandleTokenStreamObjectReference(NewObjectsToSerialize, CurrentObject, Object, TokenIndices[ReferenceIndex], bAllowReferenceElimination);
+		}
+	}
+
+	/**
+	 * Processes all references described by a compiled reference schema block
+	 * @param Schema Compiled reference schema of the current object's class
+	 * @param BlockIndex Index of the block to process
+	 * @param Data Memory of the object or struct array element the block describes
+	 * @param NewObjectsToSerialize List of new objects to process as a result of processing the references
+	 * @param CurrentObject current object being processed
+	 * @param ReferenceCollector Collector passed to native AddStructReferencedObjects functions
+	 */
+	void ProcessSchemaBlock(const FGCReferenceSchema& Schema, int32 BlockIndex, uint8* Data, TArray<UObject*>& NewObjectsToSerialize, UObject* CurrentObject, CollectorType& ReferenceCollector)
+	{
+		const FGCReferenceSchema::FBlock& Block = Schema.Blocks[BlockIndex];
+
+		ProcessSchemaReferenceList(Block.Objects, Data, NewObjectsToSerialize, CurrentObject, true);
+		ProcessSchemaReferenceList(Block.PersistentObjects, Data, NewObjectsToSerialize, CurrentObject, false);
+		if (ShouldProcessNoOpTokens())
+		{
+			ProcessSchemaReferenceList(Block.NoopObjects, Data, NewObjectsToSerialize, CurrentObject, true);
+			ProcessSchemaReferenceList(Block.NoopPersistentObjects, Data, NewObjectsToSerialize, CurrentObject, false);
+		}
+
+		for (int32 ArrayIndex = 0, ArrayNum = Block.ObjectArrays.Num(); ArrayIndex < ArrayNum; ++ArrayIndex)
+		{
+			TArray<UObject*>& ObjectArray = *((TArray<UObject*>*)(Data + Block.ObjectArrays.Offsets[ArrayIndex]));
+			const uint32 ReferenceTokenStreamIndex = Block.ObjectArrays.TokenIndices[ArrayIndex];
+			for (int32 ObjectIndex = 0, ObjectNum = ObjectArray.Num(); ObjectIndex < ObjectNum; ++ObjectIndex)
+			{
+				ReferenceProcessor.HandleTokenStreamObjectReference(NewObjectsToSerialize, CurrentObject, ObjectArray[ObjectIndex], ReferenceTokenStreamIndex, true);
+			}
+		}
+
+		for (const FGCReferenceSchema::FStructArray& StructArray : Block.StructArrays)
+		{
+			uint8* ElementData;
+			int32 ElementNum;
+			if (StructArray.FixedCount)
+			{
+				// Fixed array element offsets already include the array offset
+				ElementData = Data;
+				ElementNum = (int32)StructArray.FixedCount;
+			}
+			else
+			{
+				const FScriptArray& Array = *((FScriptArray*)(Data + StructArray.Offset));
+				ElementData = (uint8*)Array.GetData();
+				ElementNum = Array.Num();
+			}
+			for (int32 ElementIndex = 0; ElementIndex < ElementNum; ++ElementIndex, ElementData += StructArray.Stride)
+			{
+				ProcessSchemaBlock(Schema, StructArray.BlockIndex, ElementData, NewObjectsToSerialize, CurrentObject, ReferenceCollector);
+			}
+		}
+
+		for (const FGCReferenceSchema::FStructReferencedObjectsCall& Call : Block.StructReferencedObjectsCalls)
+		{
+			Call.Func(Data + Call.Offset, ReferenceCollector);
+		}
+	}
+#endif // UE_GC_USE_REFERENCE_SCHEMA
+
 	/**
 	 * Handles weak object pointer references
 	 * @param WeakPtr weak object pointer
@@ -689,6 +769,27 @@ private:
 				// Keep track of token return count in separate integer as arrays need to fiddle with it.
 				int32 TokenReturnCount = 0;
 
+#if UE_GC_USE_REFERENCE_SCHEMA
+				// Walk the precompiled schema instead of interpreting the token stream when the class has one.
+				const FGCReferenceSchema& Schema = TokenStream->GetSchema();
+				if (GUseGCReferenceSchema && Schema.IsCompiled())
+				{
+					ProcessSchemaBlock(Schema, 0, (uint8*)CurrentObject, NewObjectsToSerialize, CurrentObject, ReferenceCollector);
+					if (Schema.ExternalPackageTokenIndex != INDEX_NONE)
+					{
+						// Test if the object isn't itself, since currently package are their own external and tracking that reference is pointless
+						UObject* Object = CurrentObject->GetExternalPackageInternal();
+						Object = Object != CurrentObject ? Object : nullptr;
+						ReferenceProcessor.HandleTokenStreamObjectReference(NewObjectsToSerialize, CurrentObject, Object, Schema.ExternalPackageTokenIndex, false);
+					}
+					if (Schema.AddReferencedObjects)
+					{
+						Schema.AddReferencedObjects(CurrentObject, ReferenceCollector);
+					}
+					goto EndLoop;
+				}
+#endif // UE_GC_USE_REFERENCE_SCHEMA
+
 				// Parse the token stream.
 				while (true)
 				{
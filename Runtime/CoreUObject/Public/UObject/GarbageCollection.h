@@ -26,6 +26,11 @@
 /** UObject pointer checks are disabled by default in shipping and test builds as they add roughly 20% overhead to GC times */
 #define ENABLE_GC_OBJECT_CHECKS (!(UE_BUILD_TEST || UE_BUILD_SHIPPING) || 0)
 
+/** Compile reference token streams into flat reference schemas that reachability analysis can walk without interpreting tokens */
+#ifndef UE_GC_USE_REFERENCE_SCHEMA
+#define UE_GC_USE_REFERENCE_SCHEMA 1
+#endif
+
 COREUOBJECT_API DECLARE_LOG_CATEGORY_EXTERN(LogGarbage, Warning, All);
 DECLARE_STATS_GROUP(TEXT("Garbage Collection"), STATGROUP_GC, STATCAT_Advanced);
 
@@ -189,6 +194,102 @@ struct FTokenInfo
 
 #endif // ENABLE_GC_OBJECT_CHECKS
 
+#if UE_GC_USE_REFERENCE_SCHEMA
+/**
+ * Precompiled form of a reference token stream. Plain object references are gathered into contiguous
+ * offset arrays (stored as structure of arrays so the hot loop only streams through offsets) and arrays
+ * of structs become nested blocks walked per element. Only streams made of the common token types are
+ * compiled; streams with weak, soft, delegate, map, set or field path references are left to the
+ * token stream interpreter.
+ */
+struct FGCReferenceSchema
+{
+	typedef void (*FAddStructReferencedObjectsFunc)(void*, class FReferenceCollector&);
+	typedef void (*FAddReferencedObjectsFunc)(UObject*, class FReferenceCollector&);
+
+	/** List of references of the same kind. TokenIndices maps each entry back to the token it was compiled from. */
+	struct FReferenceList
+	{
+		TArray<uint32> Offsets;
+		TArray<uint32> TokenIndices;
+
+		FORCEINLINE int32 Num() const
+		{
+			return Offsets.Num();
+		}
+		FORCEINLINE void Add(uint32 Offset, uint32 TokenIndex)
+		{
+			Offsets.Add(Offset);
+			TokenIndices.Add(TokenIndex);
+		}
+		void Shrink()
+		{
+			Offsets.Shrink();
+			TokenIndices.Shrink();
+		}
+	};
+
+	/** Dynamic (TArray) or fixed size array of structs. Fixed array elements use offsets relative to the owning block. */
+	struct FStructArray
+	{
+		uint32 Offset;
+		uint32 Stride;
+		/** Element count for fixed arrays, 0 for dynamic arrays */
+		uint32 FixedCount;
+		int32 BlockIndex;
+	};
+
+	/** Native AddStructReferencedObjects call */
+	struct FStructReferencedObjectsCall
+	{
+		uint32 Offset;
+		FAddStructReferencedObjectsFunc Func;
+	};
+
+	/** References found at a single nesting level (the object itself or one struct array element) */
+	struct FBlock
+	{
+		/** GCRT_Object and GCRT_Class */
+		FReferenceList Objects;
+		/** GCRT_PersistentObject, reference elimination is not allowed */
+		FReferenceList PersistentObjects;
+		/** GCRT_NoopClass, only processed when the collector processes no-op tokens */
+		FReferenceList NoopObjects;
+		/** GCRT_NoopPersistentObject, only processed when the collector processes no-op tokens */
+		FReferenceList NoopPersistentObjects;
+		/** GCRT_ArrayObject */
+		FReferenceList ObjectArrays;
+		TArray<FStructArray> StructArrays;
+		TArray<FStructReferencedObjectsCall> StructReferencedObjectsCalls;
+	};
+
+	/** Blocks, the first one describes the object itself */
+	TArray<FBlock> Blocks;
+	/** Static AddReferencedObjects function of the class, if it has one */
+	FAddReferencedObjectsFunc AddReferencedObjects = nullptr;
+	/** Token index of the GCRT_AddReferencedObjects token */
+	int32 AddReferencedObjectsTokenIndex = INDEX_NONE;
+	/** Token index of the GCRT_ExternalPackage token */
+	int32 ExternalPackageTokenIndex = INDEX_NONE;
+
+	/** Returns true if the token stream could be compiled and the schema can be used instead of it */
+	FORCEINLINE bool IsCompiled() const
+	{
+		return Blocks.Num() > 0;
+	}
+
+	void Reset()
+	{
+		Blocks.Reset();
+		AddReferencedObjects = nullptr;
+		AddReferencedObjectsTokenIndex = INDEX_NONE;
+		ExternalPackageTokenIndex = INDEX_NONE;
+	}
+
+	void Shrink();
+};
+#endif // UE_GC_USE_REFERENCE_SCHEMA
+
 /**
  * Reference token stream class. Used for creating and parsing stream of object references.
  */
@@ -212,6 +313,9 @@ struct FGCReferenceTokenStream
 #if ENABLE_GC_OBJECT_CHECKS
 		TokenDebugInfo.Shrink();
 #endif // ENABLE_GC_OBJECT_CHECKS
+#if UE_GC_USE_REFERENCE_SCHEMA
+		Schema.Shrink();
+#endif // UE_GC_USE_REFERENCE_SCHEMA
 	}
 
 	/** Empties the token stream entirely */
@@ -221,6 +325,9 @@ struct FGCReferenceTokenStream
 #if ENABLE_GC_OBJECT_CHECKS
 		TokenDebugInfo.Empty();
 #endif // ENABLE_GC_OBJECT_CHECKS
+#if UE_GC_USE_REFERENCE_SCHEMA
+		Schema.Reset();
+#endif // UE_GC_USE_REFERENCE_SCHEMA
 	}
 
 	/**
@@ -405,8 +512,45 @@ struct FGCReferenceTokenStream
 	FTokenInfo GetTokenInfo(int32 TokenIndex) const;
 #endif
 
+#if UE_GC_USE_REFERENCE_SCHEMA
+	/**
+	 * Compiles the assembled token stream into its reference schema. Leaves the schema empty if the
+	 * stream contains tokens the schema can't express.
+	 *
+	 * @return true if the schema has been compiled
+	 */
+	bool CompileSchema();
+
+	/** Returns the compiled reference schema (check IsCompiled() before using it) */
+	FORCEINLINE const FGCReferenceSchema& GetSchema() const
+	{
+		return Schema;
+	}
+#endif // UE_GC_USE_REFERENCE_SCHEMA
+
 private:
 
+#if UE_GC_USE_REFERENCE_SCHEMA
+	/**
+	 * Compiles tokens into the specified schema block until a token returning from the block is found.
+	 *
+	 * @param TokenIndex Index of the first token to compile, advanced past the compiled tokens
+	 * @param BlockIndex Schema block to compile into
+	 * @param OutReturnCount Number of levels the last compiled token returns from
+	 * @return false if a token that can't be expressed in the schema was found
+	 */
+	bool CompileSchemaBlock(uint32& TokenIndex, int32 BlockIndex, uint32& OutReturnCount);
+
+	/**
+	 * Reads the GCRT_EndOfPointer token that follows a pointer.
+	 *
+	 * @param TokenIndex Index of the token following the pointer, advanced past it
+	 * @param OutReturnCount Number of levels the pointer owning token returns from
+	 * @return false if the token is not a GCRT_EndOfPointer token
+	 */
+	bool ReadEndOfPointer(uint32& TokenIndex, uint32& OutReturnCount);
+#endif // UE_GC_USE_REFERENCE_SCHEMA
+
 	/**
 	 * Helper function to store a pointer into a preallocated token stream.
 	 *
@@ -434,6 +578,10 @@ private:
 	 */
 	TArray<FName> TokenDebugInfo;
 #endif // ENABLE_GC_OBJECT_CHECKS
+#if UE_GC_USE_REFERENCE_SCHEMA
+	/** Schema compiled from the token stream once the class token stream has been assembled */
+	FGCReferenceSchema Schema;
+#endif // UE_GC_USE_REFERENCE_SCHEMA
 };
 
 /** Prevent GC from running in the current scope */
@@ -516,6 +664,11 @@ public:
 
 };
 
+#if UE_GC_USE_REFERENCE_SCHEMA
+/** Whether reachability analysis walks compiled reference schemas instead of interpreting token streams (gc.UseReferenceSchema) */
+extern COREUOBJECT_API int32 GUseGCReferenceSchema;
+#endif // UE_GC_USE_REFERENCE_SCHEMA
+
 /** True if Garbage Collection is running. Use IsGarbageCollecting() functio n instead of using this variable directly */
 extern COREUOBJECT_API FThreadSafeBool GIsGarbageCollecting;
 
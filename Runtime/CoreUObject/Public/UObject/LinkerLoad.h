@@ -203,9 +203,11 @@ public:
 	TArray<FUntypedBulkData*> BulkDataLoaders;
 #endif // WITH_EDITOR
 
-	/** Hash table for exports.																								*/
+	/** Hash table for exports, sized to the export count with a minimum of ExportHashCount buckets.						*/
 	static constexpr int32 ExportHashCount = 256;
 	TUniquePtr<int32[]> ExportHash;
+	/** Number of buckets in ExportHash minus one.																			*/
+	int32 ExportHashMask = ExportHashCount - 1;
 
 	/**
 	* List of imports and exports that must be serialized before other exports...all packed together, see FirstExportDependency
@@ -71,12 +71,21 @@ public:
 	/** A mapping of package name to generated script SHA keys */
 	COREUOBJECT_API static TMap<FString, TArray<uint8> > PackagesToScriptSHAMap;
 
+	/** Package linker whose name and object maps are used by this export linker, null for package linkers */
+	FLinkerSave* ParentLinker = nullptr;
+
 	/** Constructor for file writer */
 	FLinkerSave(UPackage* InParent, const TCHAR* InFilename, bool bForceByteSwapping, bool bInSaveUnversioned = false );
 	/** Constructor for memory writer */
 	FLinkerSave(UPackage* InParent, bool bForceByteSwapping, bool bInSaveUnversioned = false );
 	/** Constructor for custom savers. The linker assumes ownership of the custom saver. */
 	FLinkerSave(UPackage* InParent, FArchive *InSaver, bool bForceByteSwapping, bool bInSaveUnversioned = false);
+	/**
+	 * Constructor for export linkers, which serialize a single export into their own memory writer so that
+	 * several exports can be saved concurrently. Shares the name and object maps of the package linker and
+	 * copies its archive state. Bulk data positions recorded in BulkDataToAppend are relative to the export.
+	 */
+	FLinkerSave(FLinkerSave* InParentLinker, FPackageIndex InExport);
 
 	/** Returns the appropriate name index for the source name, or 0 if not found in NameIndices */
 	int32 MapName( FNameEntryId Name) const;
@@ -478,6 +478,17 @@ public:
 		return false;
 	}
 
+	/**
+	* Called during async load and package save to determine if Serialize can run on a worker thread
+	* concurrently with the serialization of other exports of the same package.
+	*
+	* @return	true if this object's Serialize only touches its own state and is thread safe
+	*/
+	virtual bool IsSerializeThreadSafe() const
+	{
+		return false;
+	}
+
 	/**
 	* Called during garbage collection to determine if an object can have its destructor called on a worker thread.
 	*
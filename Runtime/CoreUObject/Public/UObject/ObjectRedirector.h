@@ -25,6 +25,11 @@ class UObjectRedirector : public UObject
 	void Serialize(FArchive& Ar) override;
 	void Serialize(FStructuredArchive::FRecord Record) override;
 	virtual bool NeedsLoadForEditorGame() const override;
+	/** Serialize only touches the destination reference besides the thread safe UObject state, so redirectors can be serialized concurrently */
+	virtual bool IsSerializeThreadSafe() const override
+	{
+		return true;
+	}
 	virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const override;
 
 	/**
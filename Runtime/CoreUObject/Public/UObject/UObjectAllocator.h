@@ -8,6 +8,11 @@
 
 #include "CoreMinimal.h"
 
+namespace UObjectSizeClassPools
+{
+	struct FPools;
+}
+
 class COREUOBJECT_API FUObjectAllocator
 {
 public:
@@ -19,7 +24,8 @@ public:
 	  PermanentObjectPoolSize(0),
 	  PermanentObjectPool(NULL),
 	  PermanentObjectPoolTail(NULL),
-		PermanentObjectPoolExceededTail(NULL)
+		PermanentObjectPoolExceededTail(NULL),
+		SizeClassPools(nullptr)
 	{
 	}
 
@@ -30,6 +36,19 @@ public:
 	 */
 	void AllocatePermanentObjectPool(int32 InPermanentObjectPoolSize);
 
+	/**
+	 * Makes objects that don't go to the permanent object pool be allocated from size class segregated slabs, so that
+	 * instances of the same class end up next to each other in memory. Off unless gc.UseObjectSizeClassPools is set in
+	 * the engine ini. Objects allocated before this is called are still freed correctly.
+	 */
+	void EnableSizeClassPools();
+
+	/** Returns true if small objects are allocated from size class segregated slabs */
+	FORCEINLINE bool UsesSizeClassPools() const
+	{
+		return SizeClassPools != nullptr;
+	}
+
 	/**
 	 * Prints a debugf message to allow tuning
 	 */
@@ -63,6 +82,21 @@ public:
 	 */
 	void FreeUObject(UObjectBase *Object) const;
 
+	/**
+	 * Releases object slabs that no longer contain any live objects and updates the slab memory stats.
+	 * Called after garbage has been purged.
+	 */
+	void TrimPools() const;
+
+	/**
+	 * Gets the memory used by object slabs
+	 *
+	 * @param OutNumSlabs number of committed slabs
+	 * @param OutSlabBytes total size of committed slabs in bytes
+	 * @param OutLiveObjects number of objects currently allocated from slabs
+	 */
+	void GetPoolStats(int32& OutNumSlabs, SIZE_T& OutSlabBytes, int32& OutLiveObjects) const;
+
 private:
 
 	/** Size in bytes of pool for objects disregarded for GC.								*/
@@ -73,6 +107,8 @@ private:
 	uint8*						PermanentObjectPoolTail;
 	/** Tail that exceeded the size of the permanent object pool, >= PermanentObjectPoolTail.		*/
 	uint8*						PermanentObjectPoolExceededTail;
+	/** Size class segregated slabs, shared by all allocators that enabled them, null if disabled.	*/
+	UObjectSizeClassPools::FPools*	SizeClassPools;
 };
 
 /** Global UObjectBase allocator							*/
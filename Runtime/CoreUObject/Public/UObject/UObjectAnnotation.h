@@ -10,6 +10,7 @@
 #include "UObject/UObjectArray.h"
 #include "Misc/ScopeLock.h"
 #include "Misc/ScopeRWLock.h"
+#include "Async/ParallelFor.h"
 
 /**
 * FUObjectAnnotationSparse is a helper class that is used to store sparse, slow, temporary, editor only, external 
@@ -1178,6 +1179,349 @@ private:
 
 };
 
+/**
+* FUObjectAnnotationDenseLockFree is a helper class that is used to store dense, fast, temporary, editor only, external
+* or other tangential information about UObjects.
+*
+* There is a notion of a default annotation and UObjects default to this annotation.
+*
+* Annotations are stored in chunks indexed by the object index, with a chunk table sized to fit the capacity of
+* GUObjectArray, so lookups never hash and never take a lock. Chunks are allocated on demand and are not moved or
+* freed until all annotations are removed, so references returned by GetAnnotationRef stay valid while other threads
+* add annotations. Annotating different objects from multiple threads is safe, modifying the annotation of the same
+* object from multiple threads requires external synchronization.
+*
+* Annotations are automatically returned to the default when UObjects are destroyed.
+* Annotation are not "garbage collection aware", so it isn't safe to store pointers to other UObjects in an 
+* annotation unless external guarantees are made such that destruction of the other object removes the
+* annotation.
+* @param TAnnotation type of the annotation
+* @param bAutoRemove if true, annotation will automatically be removed, otherwise in non-final builds it will verify that the annotation was removed by other means prior to destruction.
+**/
+template<typename TAnnotation, bool bAutoRemove, int32 NumAnnotationsPerChunk = 64 * 1024>
+class FUObjectAnnotationDenseLockFree : public FUObjectArray::FUObjectDeleteListener
+{
+	/** Master table to chunks of annotations, allocated on first use **/
+	TAnnotation** volatile Chunks;
+	/** Number of entries in the master table **/
+	int32 MaxChunks;
+	/** Number of chunks currently allocated **/
+	FThreadSafeCounter NumAllocatedChunks;
+	/** Guards allocating and freeing the master table **/
+	FCriticalSection ChunksCritical;
+
+	/**
+	* Returns the master table, allocating it and registering as a delete listener if necessary
+	**/
+	TAnnotation** GetOrAllocateChunks()
+	{
+		TAnnotation** LocalChunks = Chunks;
+		if (!LocalChunks)
+		{
+			FScopeLock ChunksLock(&ChunksCritical);
+			LocalChunks = Chunks;
+			if (!LocalChunks)
+			{
+				// GUObjectArray never grows past its capacity so the master table never needs to be reallocated
+				const int32 NewMaxChunks = GUObjectArray.GetObjectArrayCapacity() / NumAnnotationsPerChunk + 1;
+				LocalChunks = new TAnnotation*[NewMaxChunks];
+				FMemory::Memzero(LocalChunks, sizeof(TAnnotation*) * NewMaxChunks);
+				MaxChunks = NewMaxChunks;
+
+				// we are adding the first one, so if we are auto removing or verifying removal, register now
+#if (UE_BUILD_SHIPPING || UE_BUILD_TEST)
+				if (bAutoRemove)
+#endif
+				{
+					GUObjectArray.AddUObjectDeleteListener(this);
+				}
+
+				FPlatformMisc::MemoryBarrier();
+				Chunks = LocalChunks;
+			}
+		}
+		return LocalChunks;
+	}
+
+	/**
+	* Returns the annotation for the specified index, allocating the chunk it resides in if necessary
+	**/
+	TAnnotation& GetOrAllocateAnnotation(int32 Index)
+	{
+		check(Index >= 0);
+		TAnnotation** LocalChunks = GetOrAllocateChunks();
+		const int32 ChunkIndex = Index / NumAnnotationsPerChunk;
+		check(ChunkIndex < MaxChunks);
+
+		TAnnotation* Chunk = LocalChunks[ChunkIndex];
+		if (!Chunk)
+		{
+			TAnnotation* NewChunk = new TAnnotation[NumAnnotationsPerChunk];
+			Chunk = (TAnnotation*)FPlatformAtomics::InterlockedCompareExchangePointer((void**)&LocalChunks[ChunkIndex], NewChunk, nullptr);
+			if (Chunk)
+			{
+				// someone else beat us to the add
+				delete[] NewChunk;
+			}
+			else
+			{
+				Chunk = NewChunk;
+				NumAllocatedChunks.Increment();
+			}
+		}
+		return Chunk[Index % NumAnnotationsPerChunk];
+	}
+
+	/**
+	* Returns the annotation for the specified index or nullptr if its chunk hasn't been allocated
+	**/
+	FORCEINLINE TAnnotation* FindAnnotation(int32 Index) const
+	{
+		check(Index >= 0);
+		TAnnotation** LocalChunks = Chunks;
+		const int32 ChunkIndex = Index / NumAnnotationsPerChunk;
+		if (LocalChunks && ChunkIndex < MaxChunks)
+		{
+			if (TAnnotation* Chunk = LocalChunks[ChunkIndex])
+			{
+				return &Chunk[Index % NumAnnotationsPerChunk];
+			}
+		}
+		return nullptr;
+	}
+
+public:
+
+	/** Constructor : Probably not thread safe **/
+	FUObjectAnnotationDenseLockFree() TSAN_SAFE
+		: Chunks(nullptr)
+		, MaxChunks(0)
+	{
+	}
+
+	/**
+	 * Destructor, removes all annotations, which removes the annotation as a uobject destruction listener
+	 */
+	virtual ~FUObjectAnnotationDenseLockFree()
+	{
+		RemoveAllAnnotations();
+	}
+
+	/**
+	 * Add an annotation to the annotation list. If the Annotation is the default, then the annotation is removed.
+	 *
+	 * @param Object        Object to annotate.
+	 * @param Annotation    Annotation to associate with Object.
+	 */
+	void AddAnnotation(const UObjectBase* Object, const TAnnotation& Annotation)
+	{
+		check(Object);
+		AddAnnotation(GUObjectArray.ObjectToIndex(Object), Annotation);
+	}
+
+	void AddAnnotation(const UObjectBase* Object, TAnnotation&& Annotation)
+	{
+		check(Object);
+		AddAnnotation(GUObjectArray.ObjectToIndex(Object), MoveTemp(Annotation));
+	}
+
+	/**
+	 * Add an annotation to the annotation list. If the Annotation is the default, then the annotation is removed.
+	 *
+	 * @param Index         Index of object to annotate.
+	 * @param Annotation    Annotation to associate with Object.
+	 */
+	void AddAnnotation(int32 Index, const TAnnotation& Annotation)
+	{
+		if (Annotation.IsDefault())
+		{
+			RemoveAnnotation(Index); // adding the default annotation is the same as removing an annotation
+		}
+		else
+		{
+			GetOrAllocateAnnotation(Index) = Annotation;
+		}
+	}
+
+	void AddAnnotation(int32 Index, TAnnotation&& Annotation)
+	{
+		if (Annotation.IsDefault())
+		{
+			RemoveAnnotation(Index); // adding the default annotation is the same as removing an annotation
+		}
+		else
+		{
+			GetOrAllocateAnnotation(Index) = MoveTemp(Annotation);
+		}
+	}
+
+	/**
+	 * Removes an annotation from the annotation list.
+	 *
+	 * @param Object		Object to de-annotate.
+	 */
+	void RemoveAnnotation(const UObjectBase *Object)
+	{
+		check(Object);
+		RemoveAnnotation(GUObjectArray.ObjectToIndex(Object));
+	}
+
+	/**
+	 * Removes an annotation from the annotation list.
+	 *
+	 * @param Index			Index of object to de-annotate.
+	 */
+	void RemoveAnnotation(int32 Index)
+	{
+		if (TAnnotation* Annotation = FindAnnotation(Index))
+		{
+			*Annotation = TAnnotation();
+		}
+	}
+
+	/**
+	 * Return the annotation associated with a uobject
+	 *
+	 * @param Object		Object to return the annotation for
+	 */
+	FORCEINLINE TAnnotation GetAnnotation(const UObjectBase *Object) const
+	{
+		check(Object);
+		return GetAnnotation(GUObjectArray.ObjectToIndex(Object));
+	}
+
+	/**
+	 * Return the annotation associated with a uobject
+	 *
+	 * @param Index		Index of the annotation to return
+	 */
+	FORCEINLINE TAnnotation GetAnnotation(int32 Index) const
+	{
+		if (TAnnotation* Annotation = FindAnnotation(Index))
+		{
+			return *Annotation;
+		}
+		return TAnnotation();
+	}
+
+	/**
+	 * Return the annotation associated with a uobject. Adds one if the object has no annotation yet.
+	 *
+	 * @param Object		Object to return the annotation for
+	 * @return				Reference to the annotation, remains valid until the object is destroyed.
+	 */
+	FORCEINLINE TAnnotation& GetAnnotationRef(const UObjectBase *Object)
+	{
+		check(Object);
+		return GetAnnotationRef(GUObjectArray.ObjectToIndex(Object));
+	}
+
+	/**
+	 * Return the annotation associated with a uobject. Adds one if the object has no annotation yet.
+	 *
+	 * @param Index		Index of the annotation to return
+	 * @return			Reference to the annotation, remains valid until the object is destroyed.
+	 */
+	FORCEINLINE TAnnotation& GetAnnotationRef(int32 Index)
+	{
+		return GetOrAllocateAnnotation(Index);
+	}
+
+	/**
+	 * Calls the specified function for each non-default annotation. Chunks are processed in parallel.
+	 * Annotations must not be added or removed from within the callback.
+	 *
+	 * @param Func			Function to call with the object index and the annotation
+	 * @param bForceSingleThreaded	if true, all chunks are processed on the calling thread
+	 */
+	void ParallelForEachAnnotation(TFunctionRef<void(int32, TAnnotation&)> Func, bool bForceSingleThreaded = false)
+	{
+		TAnnotation** LocalChunks = Chunks;
+		if (!LocalChunks)
+		{
+			return;
+		}
+		const int32 NumChunks = FMath::Min(MaxChunks, GUObjectArray.GetObjectArrayNum() / NumAnnotationsPerChunk + 1);
+		ParallelFor(NumChunks, [LocalChunks, &Func](int32 ChunkIndex)
+		{
+			if (TAnnotation* Chunk = LocalChunks[ChunkIndex])
+			{
+				const int32 FirstIndex = ChunkIndex * NumAnnotationsPerChunk;
+				for (int32 WithinChunkIndex = 0; WithinChunkIndex < NumAnnotationsPerChunk; ++WithinChunkIndex)
+				{
+					if (!Chunk[WithinChunkIndex].IsDefault())
+					{
+						Func(FirstIndex + WithinChunkIndex, Chunk[WithinChunkIndex]);
+					}
+				}
+			}
+		}, bForceSingleThreaded);
+	}
+
+	/**
+	 * Removes all annotation from the annotation list and frees all chunks. Not safe to call while other threads access annotations.
+	 */
+	void RemoveAllAnnotations()
+	{
+		FScopeLock ChunksLock(&ChunksCritical);
+		TAnnotation** LocalChunks = Chunks;
+		if (LocalChunks)
+		{
+			Chunks = nullptr;
+			FPlatformMisc::MemoryBarrier();
+			for (int32 ChunkIndex = 0; ChunkIndex < MaxChunks; ++ChunkIndex)
+			{
+				delete[] LocalChunks[ChunkIndex];
+			}
+			delete[] LocalChunks;
+			MaxChunks = 0;
+			NumAllocatedChunks.Reset();
+
+			// we are removing the last one, so if we are auto removing or verifying removal, unregister now
+#if (UE_BUILD_SHIPPING || UE_BUILD_TEST)
+			if (bAutoRemove)
+#endif
+			{
+				GUObjectArray.RemoveUObjectDeleteListener(this);
+			}
+		}
+	}
+
+	/** Returns the memory allocated by the chunks and the master table */
+	uint32 GetAllocatedSize() const
+	{
+		return MaxChunks * sizeof(TAnnotation*) + NumAllocatedChunks.GetValue() * NumAnnotationsPerChunk * sizeof(TAnnotation);
+	}
+
+	/**
+	 * Interface for FUObjectAllocator::FUObjectDeleteListener
+	 *
+	 * @param Object object that has been destroyed
+	 * @param Index	index of object that is being deleted
+	 */
+	virtual void NotifyUObjectDeleted(const UObjectBase *Object, int32 Index)
+	{
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+		if (!bAutoRemove)
+		{
+			// in this case we are only verifying that the external assurances of removal are met
+			TAnnotation* Annotation = FindAnnotation(Index);
+			check(!Annotation || Annotation->IsDefault());
+		}
+		else
+#endif
+		{
+			RemoveAnnotation(Index);
+		}
+	}
+
+	virtual void OnUObjectArrayShutdown() override
+	{
+		RemoveAllAnnotations();
+		GUObjectArray.RemoveUObjectDeleteListener(this);
+	}
+};
+
 /**
 * FUObjectAnnotationDenseBool is custom annotation that tracks a bool per UObject. 
 **/
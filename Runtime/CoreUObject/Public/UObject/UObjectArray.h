@@ -674,6 +674,20 @@ public:
 	 */
 	void AllocateUObjectIndex(class UObjectBase* Object, bool bMergingThreads = false);
 
+	/**
+	 * Reserves a range of object indices for objects allocated by the calling thread, so that a batch of objects
+	 * can be added without taking the object array lock for each of them. Nothing is reserved while there are
+	 * recycled indices available or while the disregard for GC pool is open. Nested reservations use the outermost range.
+	 *
+	 * @param	NumObjects Number of objects the calling thread expects to allocate before ReleaseUObjectIndexReservation
+	 */
+	void ReserveUObjectIndices(int32 NumObjects);
+
+	/**
+	 * Ends a reservation made by ReserveUObjectIndices, returning the unused indices to the available list
+	 */
+	void ReleaseUObjectIndexReservation();
+
 	/**
 	 * Returns a UObject index top to the global uobject array
 	 *
@@ -866,6 +880,16 @@ public:
 		return ObjLastNonGCIndex + 1;
 	}
 
+	/**
+	 * Returns the maximum number of objects the global UObject array can hold
+	 *
+	 * @return	the capacity of the global array
+	 */
+	FORCEINLINE int32 GetObjectArrayCapacity() const
+	{
+		return ObjObjects.Capacity();
+	}
+
 #if UE_GC_TRACK_OBJ_AVAILABLE
 	/**
 	 * Returns the number of actual object indices that are claimed (the total size of the global object array minus
@@ -1080,6 +1104,7 @@ struct FUObjectCluster
 	FUObjectCluster()
 		: RootIndex(INDEX_NONE)
 		, bNeedsDissolving(false)
+		, bAutoCreated(false)
 	{}
 
 	/** Root object index */
@@ -1095,6 +1120,8 @@ struct FUObjectCluster
 
 	/** Cluster needs dissolving, probably due to PendingKill reference */
 	bool bNeedsDissolving;
+	/** Cluster was created by the automatic reference graph analysis rather than by an asset opting in */
+	bool bAutoCreated;
 };
 
 class COREUOBJECT_API FUObjectClusterContainer
@@ -1181,6 +1208,21 @@ public:
 extern COREUOBJECT_API FUObjectArray GUObjectArray;
 extern COREUOBJECT_API FUObjectClusterContainer GUObjectClusters;
 
+/**
+ * Reserves object indices in GUObjectArray for a batch of objects created by the current thread for the lifetime of the scope.
+ */
+struct FScopedUObjectIndexReservation
+{
+	explicit FScopedUObjectIndexReservation(int32 NumObjects)
+	{
+		GUObjectArray.ReserveUObjectIndices(NumObjects);
+	}
+	~FScopedUObjectIndexReservation()
+	{
+		GUObjectArray.ReleaseUObjectIndexReservation();
+	}
+};
+
 /**
 	* Static version of IndexToObject for use with TWeakObjectPtr.
 	*/
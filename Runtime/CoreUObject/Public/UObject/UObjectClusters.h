@@ -23,7 +23,22 @@ COREUOBJECT_API void ListClusters(const TArray<FString>& Args);
 // Attempts to find clusters with no references to them
 COREUOBJECT_API void FindStaleClusters(const TArray<FString>& Args);
 
+// Dumps cluster statistics (coverage, mutable references, estimated mark work saved) to log.
+COREUOBJECT_API void ReportClusterEffectiveness(const TArray<FString>& Args);
+
 #endif // !UE_BUILD_SHIPPING
 
+/**
+ * Analyzes the reference graph of loaded, currently unclustered objects in standalone assets outside of map packages and
+ * creates clusters from large, stable subgraphs that did not opt in to clustering through CanBeClusterRoot().
+ * Must be called from the game thread while the GC lock is not held. Does nothing while loading, including async loading.
+ * @param bForce if true, skips the stability requirement (objects must otherwise survive two consecutive passes)
+ * @return Number of clusters created
+ */
+COREUOBJECT_API int32 CreateAutomaticClusters(bool bForce = false);
+
+/** Called after each garbage collection once the GC lock has been released, runs CreateAutomaticClusters() every gc.AutoClusteringInterval collections if enabled */
+void TickAutomaticClustering();
+
 // Whether object clusters can be created or not.
 bool CanCreateObjectClusters();
@@ -102,31 +102,68 @@ COREUOBJECT_API void ForEachObjectWithPackage(const class UPackage* Outer, TFunc
  * @param	ClassToLookFor				Class of the objects to return.
  * @param	Results						An output list of objects of the specified class.
  * @param	bIncludeDerivedClasses		If true, the results will include objects of child classes as well.
- * @param	AdditionalExcludeFlags		Objects with any of these flags will be excluded from the results.
- * @param	ExclusiveInternalFlags	Specifies internal flags to use as a filter for which objects to return
+ * @param	ExcludeFlags				Objects with any of these flags will be excluded from the results.
+ * @param	ExclusionInternalFlags		Objects with any of these internal flags will be excluded from the results. Unreachable objects, and objects still being async loaded unless called from the async loading thread, are always excluded.
  */
 COREUOBJECT_API void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject *>& Results, bool bIncludeDerivedClasses = true, EObjectFlags ExcludeFlags = RF_ClassDefaultObject, EInternalObjectFlags ExclusionInternalFlags = EInternalObjectFlags::None);
 
 /**
  * Performs an operation on all objects of the provided class
  *
- * @param	Outer						UObject class to loop over instances of
+ * @param	ClassToLookFor				UObject class to loop over instances of
  * @param	Operation					Function to be called for each object
  * @param	bIncludeDerivedClasses		If true, the results will include objects of child classes as well.
- * @param	AdditionalExcludeFlags		Objects with any of these flags will be excluded from the results.
+ * @param	ExcludeFlags				Objects with any of these flags will be excluded from the results.
+ * @param	ExclusionInternalFlags		Objects with any of these internal flags will be excluded from the results. Unreachable objects, and objects still being async loaded unless called from the async loading thread, are always excluded.
  */
 COREUOBJECT_API void ForEachObjectOfClass(const UClass* ClassToLookFor, TFunctionRef<void(UObject*)> Operation, bool bIncludeDerivedClasses = true, EObjectFlags ExcludeFlags = RF_ClassDefaultObject, EInternalObjectFlags ExclusionInternalFlags = EInternalObjectFlags::None);
 
 /**
  * Performs an operation on all objects of the provided classes
  *
- * @param	Classes						UObject Classes to loop over instances of
+ * @param	ClassesToLookFor			UObject Classes to loop over instances of, derived classes are not included
  * @param	Operation					Function to be called for each object
- * @param	bIncludeDerivedClasses		If true, the results will include objects of child classes as well.
- * @param	AdditionalExcludeFlags		Objects with any of these flags will be excluded from the results.
+ * @param	ExcludeFlags				Objects with any of these flags will be excluded from the results.
+ * @param	ExclusionInternalFlags		Objects with any of these internal flags will be excluded from the results. Unreachable objects, and objects still being async loaded unless called from the async loading thread, are always excluded.
  */
 COREUOBJECT_API void ForEachObjectOfClasses(TArrayView<const UClass*> ClassesToLookFor, TFunctionRef<void(UObject*)> Operation, EObjectFlags ExcludeFlags = RF_ClassDefaultObject, EInternalObjectFlags ExclusionInternalFlags = EInternalObjectFlags::None);
 
+/** Order in which GetObjectIndicesOfClass and ParallelForEachObjectOfClass return objects */
+enum class EObjectOfClassOrder : uint8
+{
+	/** Order depends on the order objects were created and destroyed in (fastest) */
+	Unordered,
+	/** Objects are sorted by their index in GUObjectArray, deterministic for the same set of objects */
+	ObjectIndex,
+};
+
+/**
+ * Returns GUObjectArray indices of all objects of a specific class without taking the global UObject hash tables lock.
+ * The indices are a snapshot and objects may have been destroyed by the time they're used unless GC is locked.
+ *
+ * @param	ClassToLookFor				Class of the objects to return.
+ * @param	OutObjectIndices			An output list of object indices, new indices are appended.
+ * @param	bIncludeDerivedClasses		If true, the results will include objects of child classes as well.
+ * @param	Order						Order of the returned indices.
+ */
+COREUOBJECT_API void GetObjectIndicesOfClass(const UClass* ClassToLookFor, TArray<int32>& OutObjectIndices, bool bIncludeDerivedClasses = true, EObjectOfClassOrder Order = EObjectOfClassOrder::Unordered);
+
+/**
+ * Performs an operation on all objects of the provided class in parallel. The objects are gathered under the global UObject
+ * hash tables lock, which is released before the operation is called, so the operation is allowed to create new objects.
+ * Objects created by the operation are not visited. Like the results of GetObjectsOfClass, the objects are only guaranteed
+ * to stay alive while the caller prevents them from being destroyed, for example by not running GC.
+ *
+ * @param	ClassToLookFor				UObject class to loop over instances of
+ * @param	Operation					Function to be called for each object, must be thread safe
+ * @param	bIncludeDerivedClasses		If true, the results will include objects of child classes as well.
+ * @param	ExcludeFlags				Objects with any of these flags will be excluded from the results.
+ * @param	ExclusionInternalFlags		Objects with any of these internal flags will be excluded from the results. Unreachable objects, and objects still being async loaded unless called from the async loading thread, are always excluded.
+ * @param	Order						Order objects are distributed to worker threads in.
+ * @param	bForceSingleThreaded		If true, all objects are processed on the calling thread.
+ */
+COREUOBJECT_API void ParallelForEachObjectOfClass(const UClass* ClassToLookFor, TFunctionRef<void(UObject*)> Operation, bool bIncludeDerivedClasses = true, EObjectFlags ExcludeFlags = RF_ClassDefaultObject, EInternalObjectFlags ExclusionInternalFlags = EInternalObjectFlags::None, EObjectOfClassOrder Order = EObjectOfClassOrder::Unordered, bool bForceSingleThreaded = false);
+
 /**
  * Returns an array of classes that were derived from the specified class.
  *